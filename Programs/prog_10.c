@@ -0,0 +1,645 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define NIL 0xFFFFFFFFu
+#define LIST_MAGIC 0x314C4449u  // "IDL1"
+
+// Node stored in the arena; links are 32-bit indices instead of pointers
+typedef struct {
+    int data;
+    uint32_t prev;
+    uint32_t next;
+} IndexNode;
+
+// Index-linked doubly linked list kept in one contiguous growable array
+typedef struct {
+    IndexNode *nodes;   // Arena of nodes
+    uint32_t capacity;  // Allocated slots
+    uint32_t used;      // Slots handed out so far (high-water mark)
+    uint32_t head;      // First node or NIL
+    uint32_t tail;      // Last node or NIL
+    uint32_t freeHead;  // Deleted slots, chained through next
+    uint32_t count;     // Number of live nodes
+} IndexList;
+
+// Header written in front of the arena when saving
+typedef struct {
+    uint32_t magic;
+    uint32_t used;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t freeHead;
+    uint32_t count;
+} ListHeader;
+
+// Pointer-based node from Program 4, used for the comparison
+typedef struct Node {
+    int data;
+    struct Node *prev;
+    struct Node *next;
+} Node;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ==================== INDEX LIST FUNCTIONS ====================
+
+// Function to initialize an empty list with room for initialCapacity nodes
+void initList(IndexList *list, uint32_t initialCapacity) {
+    if (initialCapacity < 4) {
+        initialCapacity = 4;
+    }
+
+    list->nodes = (IndexNode*)malloc(sizeof(IndexNode) * initialCapacity);
+    if (list->nodes == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    list->capacity = initialCapacity;
+    list->used = 0;
+    list->head = NIL;
+    list->tail = NIL;
+    list->freeHead = NIL;
+    list->count = 0;
+}
+
+// Function to take a slot from the free list or the end of the arena
+uint32_t allocNode(IndexList *list, int data) {
+    uint32_t index;
+
+    if (list->freeHead != NIL) {
+        index = list->freeHead;
+        list->freeHead = list->nodes[index].next;
+    } else {
+        if (list->used == list->capacity) {
+            if (list->capacity >= NIL / 2) {
+                printf("List is full!\n");
+                exit(1);
+            }
+
+            // Double the arena; indices stay valid when it moves
+            uint32_t newCapacity = list->capacity * 2;
+            IndexNode *grown = (IndexNode*)realloc(list->nodes, sizeof(IndexNode) * newCapacity);
+            if (grown == NULL) {
+                printf("Memory allocation failed!\n");
+                exit(1);
+            }
+            list->nodes = grown;
+            list->capacity = newCapacity;
+        }
+        index = list->used++;
+    }
+
+    list->nodes[index].data = data;
+    list->nodes[index].prev = NIL;
+    list->nodes[index].next = NIL;
+    return index;
+}
+
+// Function to insert at the beginning
+uint32_t insertAtBeginning(IndexList *list, int data) {
+    uint32_t index = allocNode(list, data);
+
+    list->nodes[index].next = list->head;
+    if (list->head != NIL) {
+        list->nodes[list->head].prev = index;
+    } else {
+        list->tail = index;
+    }
+    list->head = index;
+    list->count++;
+    return index;
+}
+
+// Function to insert at the end (O(1) thanks to the tail index)
+uint32_t insertAtEnd(IndexList *list, int data) {
+    uint32_t index = allocNode(list, data);
+
+    list->nodes[index].prev = list->tail;
+    if (list->tail != NIL) {
+        list->nodes[list->tail].next = index;
+    } else {
+        list->head = index;
+    }
+    list->tail = index;
+    list->count++;
+    return index;
+}
+
+// Function to find a node with given data
+uint32_t findNode(IndexList *list, int data) {
+    uint32_t current = list->head;
+    while (current != NIL) {
+        if (list->nodes[current].data == data) {
+            return current;
+        }
+        current = list->nodes[current].next;
+    }
+    return NIL;
+}
+
+// Function to link a new node after the node at index target
+uint32_t insertAfterIndex(IndexList *list, uint32_t target, int data) {
+    uint32_t index = allocNode(list, data);
+    uint32_t next = list->nodes[target].next;
+
+    list->nodes[index].prev = target;
+    list->nodes[index].next = next;
+
+    if (next != NIL) {
+        list->nodes[next].prev = index;
+    } else {
+        list->tail = index;
+    }
+    list->nodes[target].next = index;
+    list->count++;
+    return index;
+}
+
+// Function to link a new node before the node at index target
+uint32_t insertBeforeIndex(IndexList *list, uint32_t target, int data) {
+    uint32_t index = allocNode(list, data);
+    uint32_t prev = list->nodes[target].prev;
+
+    list->nodes[index].prev = prev;
+    list->nodes[index].next = target;
+
+    if (prev != NIL) {
+        list->nodes[prev].next = index;
+    } else {
+        list->head = index;
+    }
+    list->nodes[target].prev = index;
+    list->count++;
+    return index;
+}
+
+// Function to unlink the node at index and return its slot to the free list
+void deleteAtIndex(IndexList *list, uint32_t index) {
+    uint32_t prev = list->nodes[index].prev;
+    uint32_t next = list->nodes[index].next;
+
+    if (prev != NIL) {
+        list->nodes[prev].next = next;
+    } else {
+        list->head = next;
+    }
+
+    if (next != NIL) {
+        list->nodes[next].prev = prev;
+    } else {
+        list->tail = prev;
+    }
+
+    list->nodes[index].prev = NIL;
+    list->nodes[index].next = list->freeHead;
+    list->freeHead = index;
+    list->count--;
+}
+
+// Function to insert after a given node
+bool insertAfterNode(IndexList *list, int targetData, int newData) {
+    uint32_t target = findNode(list, targetData);
+    if (target == NIL) {
+        return false;
+    }
+    insertAfterIndex(list, target, newData);
+    return true;
+}
+
+// Function to insert before a given node
+bool insertBeforeNode(IndexList *list, int targetData, int newData) {
+    uint32_t target = findNode(list, targetData);
+    if (target == NIL) {
+        return false;
+    }
+    insertBeforeIndex(list, target, newData);
+    return true;
+}
+
+// Function to delete a specific node
+bool deleteNode(IndexList *list, int data) {
+    uint32_t target = findNode(list, data);
+    if (target == NIL) {
+        return false;
+    }
+    deleteAtIndex(list, target);
+    return true;
+}
+
+// Function to display list forward
+void displayForward(IndexList *list) {
+    if (list->head == NIL) {
+        printf("List is empty.\n");
+        return;
+    }
+
+    printf("Forward: NULL <-> ");
+    uint32_t current = list->head;
+    while (current != NIL) {
+        printf("%d", list->nodes[current].data);
+        if (list->nodes[current].next != NIL) {
+            printf(" <-> ");
+        }
+        current = list->nodes[current].next;
+    }
+    printf(" <-> NULL\n");
+}
+
+// Function to display list backward (starts directly at the tail)
+void displayBackward(IndexList *list) {
+    if (list->tail == NIL) {
+        printf("List is empty.\n");
+        return;
+    }
+
+    printf("Backward: NULL <-> ");
+    uint32_t current = list->tail;
+    while (current != NIL) {
+        printf("%d", list->nodes[current].data);
+        if (list->nodes[current].prev != NIL) {
+            printf(" <-> ");
+        }
+        current = list->nodes[current].prev;
+    }
+    printf(" <-> NULL\n");
+}
+
+// Function to count nodes
+int countNodes(IndexList *list) {
+    return (int)list->count;
+}
+
+// Function to save the list: header plus the whole arena in a single write
+bool saveList(IndexList *list, const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    ListHeader header = {LIST_MAGIC, list->used, list->head, list->tail,
+                         list->freeHead, list->count};
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(list->nodes, sizeof(IndexNode), list->used, file) == list->used;
+    fclose(file);
+    return ok;
+}
+
+// Function to free the list
+void freeList(IndexList *list) {
+    free(list->nodes);
+    list->nodes = NULL;
+    list->capacity = 0;
+    list->used = 0;
+    list->head = NIL;
+    list->tail = NIL;
+    list->freeHead = NIL;
+    list->count = 0;
+}
+
+// Function to check that a stored link is NIL or names a handed-out slot
+static bool isValidIndex(uint32_t index, uint32_t used) {
+    return index == NIL || index < used;
+}
+
+// Function to load a list saved by saveList (no relinking needed). Every
+// index in the header and in the nodes is checked against used, so a corrupt
+// or foreign file is rejected instead of sending traversals outside nodes[].
+bool loadList(IndexList *list, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+
+    ListHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != LIST_MAGIC ||
+        header.used == NIL || header.count > header.used ||
+        !isValidIndex(header.head, header.used) || !isValidIndex(header.tail, header.used) ||
+        !isValidIndex(header.freeHead, header.used) ||
+        (header.head == NIL) != (header.count == 0) || (header.tail == NIL) != (header.count == 0)) {
+        fclose(file);
+        return false;
+    }
+
+    initList(list, header.used);
+    bool ok = fread(list->nodes, sizeof(IndexNode), header.used, file) == header.used;
+    fclose(file);
+
+    for (uint32_t i = 0; ok && i < header.used; i++) {
+        ok = isValidIndex(list->nodes[i].prev, header.used) && isValidIndex(list->nodes[i].next, header.used);
+    }
+    if (!ok) {
+        freeList(list);
+        return false;
+    }
+
+    list->used = header.used;
+    list->head = header.head;
+    list->tail = header.tail;
+    list->freeHead = header.freeHead;
+    list->count = header.count;
+    return true;
+}
+
+// ==================== POINTER LIST (PROGRAM 4 LAYOUT) ====================
+
+// Function to create a new node
+Node* createNode(int data) {
+    Node *newNode = (Node*)malloc(sizeof(Node));
+    if (newNode == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    newNode->data = data;
+    newNode->prev = NULL;
+    newNode->next = NULL;
+    return newNode;
+}
+
+// Function to append with a tail pointer so both versions build in O(1)
+Node* appendNode(Node **head, Node **tail, int data) {
+    Node *newNode = createNode(data);
+    newNode->prev = *tail;
+    if (*tail != NULL) {
+        (*tail)->next = newNode;
+    } else {
+        *head = newNode;
+    }
+    *tail = newNode;
+    return newNode;
+}
+
+// Function to unlink a node without freeing it
+void unlinkPtrNode(Node **head, Node **tail, Node *node) {
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        *head = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        *tail = node->prev;
+    }
+}
+
+// Function to relink an unlinked node after target
+void linkPtrNodeAfter(Node **tail, Node *target, Node *node) {
+    node->prev = target;
+    node->next = target->next;
+    if (target->next != NULL) {
+        target->next->prev = node;
+    } else {
+        *tail = node;
+    }
+    target->next = node;
+}
+
+// Function to free the pointer list
+void freePtrList(Node *head) {
+    Node *temp;
+    while (head != NULL) {
+        temp = head;
+        head = head->next;
+        free(temp);
+    }
+}
+
+// ==================== BENCHMARK ====================
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// Function to compare both layouts on build, churn and traversal
+void runComparison(int n) {
+    uint32_t *indexHandles = (uint32_t*)malloc(sizeof(uint32_t) * n);
+    Node **ptrHandles = (Node**)malloc(sizeof(Node*) * n);
+    if (indexHandles == NULL || ptrHandles == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    IndexList list;
+    Node *head = NULL;
+    Node *tail = NULL;
+    double start, indexTime, ptrTime;
+    long long indexSum, ptrSum;
+
+    printf("\nElements: %d\n\n", n);
+    printf("Memory per node:\n");
+    printf("  Pointer node (Program 4): %2zu bytes (+ malloc header, ~32 bytes per chunk on glibc)\n",
+           sizeof(Node));
+    printf("  Index node (arena):       %2zu bytes\n\n", sizeof(IndexNode));
+
+    printf("%-28s %14s %14s %9s\n", "Operation", "Pointer ns/op", "Index ns/op", "Speedup");
+    printf("--------------------------------------------------------------------\n");
+
+    // Build by appending
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        ptrHandles[i] = appendNode(&head, &tail, i);
+    }
+    ptrTime = getTimeSeconds() - start;
+
+    start = getTimeSeconds();
+    initList(&list, 16);
+    for (int i = 0; i < n; i++) {
+        indexHandles[i] = insertAtEnd(&list, i);
+    }
+    indexTime = getTimeSeconds() - start;
+    printf("%-28s %14.2f %14.2f %8.2fx\n", "Build (insert at end)",
+           ptrTime * 1e9 / n, indexTime * 1e9 / n, ptrTime / indexTime);
+
+    // Churn: move random nodes after other random nodes so list order
+    // no longer matches allocation order
+    uint64_t state = 12345;
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        int a = (int)(nextRandom(&state) % n);
+        int b = (int)(nextRandom(&state) % n);
+        if (a == b) {
+            continue;
+        }
+        unlinkPtrNode(&head, &tail, ptrHandles[a]);
+        linkPtrNodeAfter(&tail, ptrHandles[b], ptrHandles[a]);
+    }
+    ptrTime = getTimeSeconds() - start;
+
+    state = 12345;
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        int a = (int)(nextRandom(&state) % n);
+        int b = (int)(nextRandom(&state) % n);
+        if (a == b) {
+            continue;
+        }
+        int data = list.nodes[indexHandles[a]].data;
+        deleteAtIndex(&list, indexHandles[a]);
+        indexHandles[a] = insertAfterIndex(&list, indexHandles[b], data);
+    }
+    indexTime = getTimeSeconds() - start;
+    printf("%-28s %14.2f %14.2f %8.2fx\n", "Random move (unlink+link)",
+           ptrTime * 1e9 / n, indexTime * 1e9 / n, ptrTime / indexTime);
+
+    // Forward traversal
+    start = getTimeSeconds();
+    ptrSum = 0;
+    for (Node *temp = head; temp != NULL; temp = temp->next) {
+        ptrSum += temp->data;
+    }
+    ptrTime = getTimeSeconds() - start;
+
+    start = getTimeSeconds();
+    indexSum = 0;
+    for (uint32_t i = list.head; i != NIL; i = list.nodes[i].next) {
+        indexSum += list.nodes[i].data;
+    }
+    indexTime = getTimeSeconds() - start;
+    printf("%-28s %14.2f %14.2f %8.2fx\n", "Forward traversal",
+           ptrTime * 1e9 / n, indexTime * 1e9 / n, ptrTime / indexTime);
+
+    // Backward traversal
+    start = getTimeSeconds();
+    long long ptrBack = 0;
+    for (Node *temp = tail; temp != NULL; temp = temp->prev) {
+        ptrBack += temp->data;
+    }
+    ptrTime = getTimeSeconds() - start;
+
+    start = getTimeSeconds();
+    long long indexBack = 0;
+    for (uint32_t i = list.tail; i != NIL; i = list.nodes[i].prev) {
+        indexBack += list.nodes[i].data;
+    }
+    indexTime = getTimeSeconds() - start;
+    printf("%-28s %14.2f %14.2f %8.2fx\n", "Backward traversal",
+           ptrTime * 1e9 / n, indexTime * 1e9 / n, ptrTime / indexTime);
+
+    long long expected = (long long)n * (n - 1) / 2;
+    printf("\nChecksums: pointer %lld/%lld, index %lld/%lld (expected %lld) - %s\n",
+           ptrSum, ptrBack, indexSum, indexBack, expected,
+           (ptrSum == expected && ptrBack == expected &&
+            indexSum == expected && indexBack == expected) ? "OK" : "MISMATCH");
+    printf("Arena size: %.1f MB for %u nodes\n",
+           (double)list.capacity * sizeof(IndexNode) / (1024 * 1024), list.count);
+
+    freePtrList(head);
+    freeList(&list);
+    free(indexHandles);
+    free(ptrHandles);
+}
+
+int main(int argc, char *argv[]) {
+    IndexList list;
+    initList(&list, 4);
+
+    printf("=========================================\n");
+    printf("  INDEX-LINKED DOUBLY LINKED LIST\n");
+    printf("  (32-bit links in a contiguous arena)\n");
+    printf("=========================================\n\n");
+
+    // Same demonstration sequence as Program 4
+    printf("Creating doubly linked list with values: 10, 20, 30, 40, 50\n\n");
+    insertAtEnd(&list, 10);
+    insertAtEnd(&list, 20);
+    insertAtEnd(&list, 30);
+    insertAtEnd(&list, 40);
+    insertAtEnd(&list, 50);
+
+    printf("Initial List:\n");
+    displayForward(&list);
+    displayBackward(&list);
+    printf("Number of nodes: %d\n\n", countNodes(&list));
+
+    printf("-------------------------------------------\n");
+    printf("Insert Operations:\n");
+    printf("-------------------------------------------\n");
+    if (insertAfterNode(&list, 30, 35)) {
+        printf("Inserted 35 after node with value 30\n");
+    }
+    displayForward(&list);
+    printf("\n");
+
+    if (insertAfterNode(&list, 50, 60)) {
+        printf("Inserted 60 after node with value 50\n");
+    }
+    displayForward(&list);
+    printf("\n");
+
+    if (insertBeforeNode(&list, 10, 5)) {
+        printf("Inserted 5 before node with value 10\n");
+    }
+    displayForward(&list);
+    printf("\n");
+
+    printf("-------------------------------------------\n");
+    printf("Delete Operations:\n");
+    printf("-------------------------------------------\n");
+    int deletes[] = {35, 5, 60, 99};
+    for (int i = 0; i < 4; i++) {
+        if (deleteNode(&list, deletes[i])) {
+            printf("Deleted node with value %d\n", deletes[i]);
+        } else {
+            printf("Node with data %d not found!\n", deletes[i]);
+        }
+        displayForward(&list);
+        printf("\n");
+    }
+
+    // Freed slots are reused before the arena grows
+    insertAtBeginning(&list, 1);
+    printf("Inserted 1 at beginning (reuses a freed slot)\n");
+    displayForward(&list);
+    displayBackward(&list);
+    printf("Arena: %u slots used, %u capacity, %d live nodes\n\n",
+           list.used, list.capacity, countNodes(&list));
+
+    // Serialization round trip
+    printf("-------------------------------------------\n");
+    printf("Serialization:\n");
+    printf("-------------------------------------------\n");
+    const char *path = "index_list.bin";
+    IndexList loaded;
+    if (saveList(&list, path) && loadList(&loaded, path)) {
+        printf("Saved %u nodes to %s and loaded them back:\n", list.count, path);
+        displayForward(&loaded);
+        displayBackward(&loaded);
+        freeList(&loaded);
+    } else {
+        printf("Could not save or load %s\n", path);
+    }
+    remove(path);
+    freeList(&list);
+
+    // Memory and throughput comparison
+    int n = 1000000;
+    if (argc > 1) {
+        n = atoi(argv[1]);
+    }
+    if (n < 2) {
+        printf("Usage: %s [numElements]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Pointer vs Index Layout Comparison:\n");
+    printf("-------------------------------------------");
+    runComparison(n);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
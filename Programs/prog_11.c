@@ -0,0 +1,432 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define POOL_BLOCK_NODES 4096
+
+// XOR-linked node: link holds (address of prev) ^ (address of next)
+typedef struct XorNode {
+    int data;
+    uintptr_t link;
+} XorNode;
+
+// XOR-linked list; traversal can start from either end
+typedef struct {
+    XorNode *head;
+    XorNode *tail;
+    int count;
+} XorList;
+
+// Standard doubly linked node from Program 4, used for the comparison
+typedef struct Node {
+    int data;
+    struct Node *prev;
+    struct Node *next;
+} Node;
+
+// Simple block allocator so both lists pay exactly sizeof(node) per node
+typedef struct PoolBlock {
+    struct PoolBlock *nextBlock;
+    unsigned char *memory;
+} PoolBlock;
+
+typedef struct {
+    size_t nodeSize;
+    int usedInBlock;
+    PoolBlock *blocks;
+    void *freeList;
+    long long blockCount;
+} NodePool;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ==================== NODE POOL ====================
+
+void initPool(NodePool *pool, size_t nodeSize) {
+    pool->nodeSize = nodeSize;
+    pool->usedInBlock = POOL_BLOCK_NODES;
+    pool->blocks = NULL;
+    pool->freeList = NULL;
+    pool->blockCount = 0;
+}
+
+// Function to allocate one node from the pool
+void* poolAlloc(NodePool *pool) {
+    if (pool->freeList != NULL) {
+        void *node = pool->freeList;
+        pool->freeList = *(void**)node;
+        return node;
+    }
+
+    if (pool->usedInBlock == POOL_BLOCK_NODES) {
+        PoolBlock *block = (PoolBlock*)malloc(sizeof(PoolBlock));
+        if (block != NULL) {
+            block->memory = (unsigned char*)malloc(pool->nodeSize * POOL_BLOCK_NODES);
+        }
+        if (block == NULL || block->memory == NULL) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        block->nextBlock = pool->blocks;
+        pool->blocks = block;
+        pool->usedInBlock = 0;
+        pool->blockCount++;
+    }
+
+    return pool->blocks->memory + pool->nodeSize * pool->usedInBlock++;
+}
+
+// Function to return a node to the pool
+void poolFree(NodePool *pool, void *node) {
+    *(void**)node = pool->freeList;
+    pool->freeList = node;
+}
+
+// Function to release every block in the pool
+void destroyPool(NodePool *pool) {
+    while (pool->blocks != NULL) {
+        PoolBlock *block = pool->blocks;
+        pool->blocks = block->nextBlock;
+        free(block->memory);
+        free(block);
+    }
+    initPool(pool, pool->nodeSize);
+}
+
+// ==================== XOR LIST FUNCTIONS ====================
+
+// Combine two node addresses into one link value
+static inline XorNode* xorPtr(XorNode *a, XorNode *b) {
+    return (XorNode*)((uintptr_t)a ^ (uintptr_t)b);
+}
+
+void initXorList(XorList *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+}
+
+// Function to create a new node from the pool
+XorNode* createXorNode(NodePool *pool, int data) {
+    XorNode *newNode = (XorNode*)poolAlloc(pool);
+    newNode->data = data;
+    newNode->link = 0;
+    return newNode;
+}
+
+// Function to insert at the beginning
+void insertAtBeginning(XorList *list, NodePool *pool, int data) {
+    XorNode *newNode = createXorNode(pool, data);
+
+    // New head: prev is NULL, next is the old head
+    newNode->link = (uintptr_t)list->head;
+
+    if (list->head != NULL) {
+        // Old head's prev changes from NULL to newNode
+        list->head->link ^= (uintptr_t)newNode;
+    } else {
+        list->tail = newNode;
+    }
+    list->head = newNode;
+    list->count++;
+}
+
+// Function to insert at the end (O(1), the tail is kept)
+void insertAtEnd(XorList *list, NodePool *pool, int data) {
+    XorNode *newNode = createXorNode(pool, data);
+
+    newNode->link = (uintptr_t)list->tail;
+
+    if (list->tail != NULL) {
+        list->tail->link ^= (uintptr_t)newNode;
+    } else {
+        list->head = newNode;
+    }
+    list->tail = newNode;
+    list->count++;
+}
+
+// Function to find a node with given data; also returns its predecessor
+XorNode* findNode(XorList *list, int data, XorNode **prevOut) {
+    XorNode *prev = NULL;
+    XorNode *current = list->head;
+
+    while (current != NULL) {
+        if (current->data == data) {
+            *prevOut = prev;
+            return current;
+        }
+        XorNode *next = xorPtr(prev, (XorNode*)current->link);
+        prev = current;
+        current = next;
+    }
+    return NULL;
+}
+
+// Function to insert after a node, given the node and its predecessor
+void insertAfter(XorList *list, NodePool *pool, XorNode *prev, XorNode *node, int data) {
+    XorNode *next = xorPtr(prev, (XorNode*)node->link);
+    XorNode *newNode = createXorNode(pool, data);
+
+    newNode->link = (uintptr_t)node ^ (uintptr_t)next;
+    node->link ^= (uintptr_t)next ^ (uintptr_t)newNode;
+
+    if (next != NULL) {
+        next->link ^= (uintptr_t)node ^ (uintptr_t)newNode;
+    } else {
+        list->tail = newNode;
+    }
+    list->count++;
+}
+
+// Function to delete a node, given the node and its predecessor (NULL for head)
+void deleteNode(XorList *list, NodePool *pool, XorNode *prev, XorNode *node) {
+    XorNode *next = xorPtr(prev, (XorNode*)node->link);
+
+    if (prev != NULL) {
+        // prev's next changes from node to next
+        prev->link ^= (uintptr_t)node ^ (uintptr_t)next;
+    } else {
+        list->head = next;
+    }
+
+    if (next != NULL) {
+        // next's prev changes from node to prev
+        next->link ^= (uintptr_t)node ^ (uintptr_t)prev;
+    } else {
+        list->tail = prev;
+    }
+
+    poolFree(pool, node);
+    list->count--;
+}
+
+// Function to delete the first node with given data
+bool deleteValue(XorList *list, NodePool *pool, int data) {
+    XorNode *prev;
+    XorNode *node = findNode(list, data, &prev);
+    if (node == NULL) {
+        return false;
+    }
+    deleteNode(list, pool, prev, node);
+    return true;
+}
+
+// Function to walk the list from one end; the same loop serves both directions
+void displayFrom(XorNode *start, const char *label) {
+    if (start == NULL) {
+        printf("List is empty.\n");
+        return;
+    }
+
+    printf("%s: NULL <-> ", label);
+    XorNode *prev = NULL;
+    XorNode *current = start;
+    while (current != NULL) {
+        XorNode *next = xorPtr(prev, (XorNode*)current->link);
+        printf("%d", current->data);
+        if (next != NULL) {
+            printf(" <-> ");
+        }
+        prev = current;
+        current = next;
+    }
+    printf(" <-> NULL\n");
+}
+
+void displayForward(XorList *list) {
+    displayFrom(list->head, "Forward");
+}
+
+void displayBackward(XorList *list) {
+    displayFrom(list->tail, "Backward");
+}
+
+// Function to sum the list from one end (used for timing)
+long long sumFrom(XorNode *start) {
+    long long sum = 0;
+    XorNode *prev = NULL;
+    XorNode *current = start;
+    while (current != NULL) {
+        XorNode *next = xorPtr(prev, (XorNode*)current->link);
+        sum += current->data;
+        prev = current;
+        current = next;
+    }
+    return sum;
+}
+
+// ==================== COMPARISON ====================
+
+// Function to build, traverse and report both layouts with n elements
+void runComparison(int n, int passes) {
+    NodePool xorPool, stdPool;
+    initPool(&xorPool, sizeof(XorNode));
+    initPool(&stdPool, sizeof(Node));
+
+    XorList xorList;
+    initXorList(&xorList);
+    Node *head = NULL;
+    Node *tail = NULL;
+
+    double start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        Node *node = (Node*)poolAlloc(&stdPool);
+        node->data = i;
+        node->next = NULL;
+        node->prev = tail;
+        if (tail != NULL) {
+            tail->next = node;
+        } else {
+            head = node;
+        }
+        tail = node;
+    }
+    double stdBuild = getTimeSeconds() - start;
+
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        insertAtEnd(&xorList, &xorPool, i);
+    }
+    double xorBuild = getTimeSeconds() - start;
+
+    long long stdForward = 0, stdBackward = 0, xorForward = 0, xorBackward = 0;
+    double stdForwardTime = 0, stdBackwardTime = 0, xorForwardTime = 0, xorBackwardTime = 0;
+
+    for (int p = 0; p < passes; p++) {
+        start = getTimeSeconds();
+        stdForward = 0;
+        for (Node *temp = head; temp != NULL; temp = temp->next) {
+            stdForward += temp->data;
+        }
+        stdForwardTime += getTimeSeconds() - start;
+
+        start = getTimeSeconds();
+        stdBackward = 0;
+        for (Node *temp = tail; temp != NULL; temp = temp->prev) {
+            stdBackward += temp->data;
+        }
+        stdBackwardTime += getTimeSeconds() - start;
+
+        start = getTimeSeconds();
+        xorForward = sumFrom(xorList.head);
+        xorForwardTime += getTimeSeconds() - start;
+
+        start = getTimeSeconds();
+        xorBackward = sumFrom(xorList.tail);
+        xorBackwardTime += getTimeSeconds() - start;
+    }
+
+    double visits = (double)n * passes;
+    double stdBytes = (double)stdPool.blockCount * POOL_BLOCK_NODES * sizeof(Node);
+    double xorBytes = (double)xorPool.blockCount * POOL_BLOCK_NODES * sizeof(XorNode);
+
+    printf("\nElements: %d, traversal passes: %d\n\n", n, passes);
+    printf("%-24s %22s %18s\n", "", "Standard (prev,next)", "XOR (prev^next)");
+    printf("----------------------------------------------------------------\n");
+    printf("%-24s %22zu %18zu\n", "Bytes per node", sizeof(Node), sizeof(XorNode));
+    printf("%-24s %22.1f %18.1f\n", "Total node memory (MB)",
+           stdBytes / (1024 * 1024), xorBytes / (1024 * 1024));
+    printf("%-24s %22.2f %18.2f\n", "Build ns/node", stdBuild * 1e9 / n, xorBuild * 1e9 / n);
+    printf("%-24s %22.2f %18.2f\n", "Forward ns/node",
+           stdForwardTime * 1e9 / visits, xorForwardTime * 1e9 / visits);
+    printf("%-24s %22.2f %18.2f\n", "Backward ns/node",
+           stdBackwardTime * 1e9 / visits, xorBackwardTime * 1e9 / visits);
+
+    long long expected = (long long)n * (n - 1) / 2;
+    printf("\nChecksums %s (expected %lld)\n",
+           (stdForward == expected && stdBackward == expected &&
+            xorForward == expected && xorBackward == expected) ? "OK" : "MISMATCH",
+           expected);
+
+    destroyPool(&xorPool);
+    destroyPool(&stdPool);
+}
+
+int main(int argc, char *argv[]) {
+    NodePool pool;
+    initPool(&pool, sizeof(XorNode));
+    XorList list;
+    initXorList(&list);
+
+    printf("=========================================\n");
+    printf("  XOR-LINKED DOUBLY LINKED LIST\n");
+    printf("=========================================\n\n");
+
+    printf("Creating XOR-linked list with values: 10, 20, 30, 40, 50\n\n");
+    insertAtEnd(&list, &pool, 10);
+    insertAtEnd(&list, &pool, 20);
+    insertAtEnd(&list, &pool, 30);
+    insertAtEnd(&list, &pool, 40);
+    insertAtEnd(&list, &pool, 50);
+
+    printf("Initial List:\n");
+    displayForward(&list);
+    displayBackward(&list);
+    printf("Number of nodes: %d\n\n", list.count);
+
+    printf("-------------------------------------------\n");
+    printf("Insert Operations:\n");
+    printf("-------------------------------------------\n");
+    insertAtBeginning(&list, &pool, 5);
+    printf("Inserted 5 at beginning\n");
+    displayForward(&list);
+
+    insertAtEnd(&list, &pool, 60);
+    printf("Inserted 60 at end\n");
+    displayForward(&list);
+
+    XorNode *prev;
+    XorNode *target = findNode(&list, 30, &prev);
+    if (target != NULL) {
+        insertAfter(&list, &pool, prev, target, 35);
+        printf("Inserted 35 after node with value 30\n");
+    }
+    displayForward(&list);
+    displayBackward(&list);
+    printf("\n");
+
+    printf("-------------------------------------------\n");
+    printf("Delete Operations (node + neighbor):\n");
+    printf("-------------------------------------------\n");
+    int deletes[] = {35, 5, 60, 99};
+    for (int i = 0; i < 4; i++) {
+        if (deleteValue(&list, &pool, deletes[i])) {
+            printf("Deleted node with value %d\n", deletes[i]);
+        } else {
+            printf("Node with data %d not found!\n", deletes[i]);
+        }
+        displayForward(&list);
+    }
+    displayBackward(&list);
+    printf("Number of nodes: %d\n", list.count);
+    destroyPool(&pool);
+
+    int n = 4000000;
+    int passes = 5;
+    if (argc > 1) {
+        n = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        passes = atoi(argv[2]);
+    }
+    if (n < 1 || passes < 1) {
+        printf("Usage: %s [numElements] [passes]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Standard vs XOR List Comparison:\n");
+    printf("-------------------------------------------");
+    runComparison(n, passes);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
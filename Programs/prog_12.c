@@ -0,0 +1,457 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+
+#define MAX_LEVEL 24
+
+// Skip list node: level 0 is a doubly linked list, higher levels are express lanes
+typedef struct SkipNode {
+    int data;
+    int level;                  // Number of forward links
+    struct SkipNode *prev;      // Backward link on level 0
+    struct SkipNode *next[];    // next[0] is the level-0 successor
+} SkipNode;
+
+// Ordered skip list
+typedef struct {
+    SkipNode *header;   // Sentinel with MAX_LEVEL links, holds no data
+    SkipNode *tail;     // Largest element (for backward scans)
+    int level;          // Highest level currently in use
+    long long count;
+    uint64_t rngState;
+} SkipList;
+
+// Node structure for the unordered list from Program 4 (baseline)
+typedef struct Node {
+    int data;
+    struct Node *prev;
+    struct Node *next;
+} Node;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// ==================== SKIP LIST FUNCTIONS ====================
+
+// Function to create a node with the given number of forward links
+SkipNode* createSkipNode(int data, int level) {
+    SkipNode *node = (SkipNode*)malloc(sizeof(SkipNode) + sizeof(SkipNode*) * level);
+    if (node == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    node->data = data;
+    node->level = level;
+    node->prev = NULL;
+    for (int i = 0; i < level; i++) {
+        node->next[i] = NULL;
+    }
+    return node;
+}
+
+// Function to initialize an empty skip list
+void initSkipList(SkipList *list, uint64_t seed) {
+    list->header = createSkipNode(0, MAX_LEVEL);
+    list->tail = NULL;
+    list->level = 1;
+    list->count = 0;
+    list->rngState = seed ? seed : 1;
+}
+
+// Function to pick a random level: P(level > k) = (1/4)^k
+int randomLevel(SkipList *list) {
+    uint64_t bits = nextRandom(&list->rngState);
+    int level = 1;
+    while ((bits & 3) == 0 && level < MAX_LEVEL) {
+        level++;
+        bits >>= 2;
+    }
+    return level;
+}
+
+// Function to find the last node < data on every level (search path)
+void findPredecessors(SkipList *list, int data, SkipNode *update[]) {
+    SkipNode *current = list->header;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (current->next[i] != NULL && current->next[i]->data < data) {
+            current = current->next[i];
+        }
+        update[i] = current;
+    }
+}
+
+// Function to find the first node with data >= value
+SkipNode* lowerBound(SkipList *list, int value) {
+    SkipNode *current = list->header;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (current->next[i] != NULL && current->next[i]->data < value) {
+            current = current->next[i];
+        }
+    }
+    return current->next[0];
+}
+
+// Function to find the last node with data <= value
+SkipNode* upperFloor(SkipList *list, int value) {
+    SkipNode *current = list->header;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (current->next[i] != NULL && current->next[i]->data <= value) {
+            current = current->next[i];
+        }
+    }
+    return current == list->header ? NULL : current;
+}
+
+// Function to search for a value in O(log n) expected time
+SkipNode* searchSkipList(SkipList *list, int data) {
+    SkipNode *node = lowerBound(list, data);
+    if (node != NULL && node->data == data) {
+        return node;
+    }
+    return NULL;
+}
+
+// Function to insert a value, keeping the list sorted (duplicates allowed)
+void insertSkipList(SkipList *list, int data) {
+    SkipNode *update[MAX_LEVEL];
+    findPredecessors(list, data, update);
+
+    int level = randomLevel(list);
+    if (level > list->level) {
+        for (int i = list->level; i < level; i++) {
+            update[i] = list->header;
+        }
+        list->level = level;
+    }
+
+    SkipNode *newNode = createSkipNode(data, level);
+    for (int i = 0; i < level; i++) {
+        newNode->next[i] = update[i]->next[i];
+        update[i]->next[i] = newNode;
+    }
+
+    // Level 0 is doubly linked
+    newNode->prev = (update[0] == list->header) ? NULL : update[0];
+    if (newNode->next[0] != NULL) {
+        newNode->next[0]->prev = newNode;
+    } else {
+        list->tail = newNode;
+    }
+    list->count++;
+}
+
+// Function to delete one occurrence of a value
+bool deleteSkipList(SkipList *list, int data) {
+    SkipNode *update[MAX_LEVEL];
+    findPredecessors(list, data, update);
+
+    SkipNode *target = update[0]->next[0];
+    if (target == NULL || target->data != data) {
+        return false;
+    }
+
+    for (int i = 0; i < target->level; i++) {
+        update[i]->next[i] = target->next[i];
+    }
+
+    if (target->next[0] != NULL) {
+        target->next[0]->prev = target->prev;
+    } else {
+        list->tail = target->prev;
+    }
+
+    // Drop empty express lanes
+    while (list->level > 1 && list->header->next[list->level - 1] == NULL) {
+        list->level--;
+    }
+
+    free(target);
+    list->count--;
+    return true;
+}
+
+// Function to copy values in [low, high] into out[], ascending or descending
+int scanRange(SkipList *list, int low, int high, bool backward, int out[], int maxOut) {
+    int found = 0;
+
+    if (!backward) {
+        for (SkipNode *node = lowerBound(list, low);
+             node != NULL && node->data <= high && found < maxOut;
+             node = node->next[0]) {
+            out[found++] = node->data;
+        }
+    } else {
+        for (SkipNode *node = upperFloor(list, high);
+             node != NULL && node->data >= low && found < maxOut;
+             node = node->prev) {
+            out[found++] = node->data;
+        }
+    }
+    return found;
+}
+
+// Function to display values in [low, high] in either direction
+void displayRange(SkipList *list, int low, int high, bool backward) {
+    int values[64];
+    int found = scanRange(list, low, high, backward, values, 64);
+
+    printf("%s [%d, %d]: ", backward ? "Backward" : "Forward", low, high);
+    for (int i = 0; i < found; i++) {
+        printf("%d ", values[i]);
+    }
+    printf("\n");
+}
+
+// Function to display every level of the skip list
+void displaySkipList(SkipList *list) {
+    for (int i = list->level - 1; i >= 0; i--) {
+        printf("Level %d: HEAD", i);
+        for (SkipNode *node = list->header->next[i]; node != NULL; node = node->next[i]) {
+            printf(" -> %d", node->data);
+        }
+        printf(" -> NULL\n");
+    }
+}
+
+// Function to free the skip list
+void freeSkipList(SkipList *list) {
+    SkipNode *node = list->header;
+    while (node != NULL) {
+        SkipNode *next = node->next[0];
+        free(node);
+        node = next;
+    }
+    list->header = NULL;
+    list->tail = NULL;
+    list->count = 0;
+}
+
+// ==================== BASELINE (PROGRAM 4) ====================
+
+// Function to create a new node
+Node* createNode(int data) {
+    Node *newNode = (Node*)malloc(sizeof(Node));
+    if (newNode == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    newNode->data = data;
+    newNode->prev = NULL;
+    newNode->next = NULL;
+    return newNode;
+}
+
+// Function to find a node with given data (linear scan, as in Program 4)
+Node* findNode(Node *head, int data) {
+    Node *temp = head;
+    while (temp != NULL) {
+        if (temp->data == data) {
+            return temp;
+        }
+        temp = temp->next;
+    }
+    return NULL;
+}
+
+// Function to free the list
+void freeList(Node *head) {
+    Node *temp;
+    while (head != NULL) {
+        temp = head;
+        head = head->next;
+        free(temp);
+    }
+}
+
+// ==================== BENCHMARK ====================
+
+void runBenchmark(int n, int linearLookups, int skipLookups) {
+    // Insert even values 0, 2, ..., 2(n-1) in random order; odd values miss
+    int *values = (int*)malloc(sizeof(int) * n);
+    if (values == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) {
+        values[i] = 2 * i;
+    }
+    uint64_t state = 2024;
+    for (int i = n - 1; i > 0; i--) {
+        int j = (int)(nextRandom(&state) % (uint64_t)(i + 1));
+        int temp = values[i];
+        values[i] = values[j];
+        values[j] = temp;
+    }
+
+    printf("\nElements: %d\n\n", n);
+
+    // Build both structures
+    double start = getTimeSeconds();
+    Node *head = NULL;
+    for (int i = n - 1; i >= 0; i--) {
+        Node *node = createNode(values[i]);
+        node->next = head;
+        if (head != NULL) {
+            head->prev = node;
+        }
+        head = node;
+    }
+    double listBuild = getTimeSeconds() - start;
+
+    SkipList list;
+    initSkipList(&list, 99);
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        insertSkipList(&list, values[i]);
+    }
+    double skipBuild = getTimeSeconds() - start;
+
+    printf("Build: unordered list %.2f s (insert at beginning), skip list %.2f s (%.0f ns/insert)\n\n",
+           listBuild, skipBuild, skipBuild * 1e9 / n);
+
+    // Lookups: half hits (even), half misses (odd)
+    int hits = 0;
+    start = getTimeSeconds();
+    for (int i = 0; i < linearLookups; i++) {
+        int key = (int)(nextRandom(&state) % (2 * (uint64_t)n));
+        if (findNode(head, key) != NULL) {
+            hits++;
+        }
+    }
+    double linearTime = (getTimeSeconds() - start) / linearLookups;
+
+    int skipHits = 0;
+    start = getTimeSeconds();
+    for (int i = 0; i < skipLookups; i++) {
+        int key = (int)(nextRandom(&state) % (2 * (uint64_t)n));
+        if (searchSkipList(&list, key) != NULL) {
+            skipHits++;
+        }
+    }
+    double skipTime = (getTimeSeconds() - start) / skipLookups;
+
+    printf("%-26s %10s %14s\n", "Search", "Lookups", "ns/lookup");
+    printf("--------------------------------------------------\n");
+    printf("%-26s %10d %14.0f   (%d hits)\n", "findNode (linear scan)", linearLookups,
+           linearTime * 1e9, hits);
+    printf("%-26s %10d %14.0f   (%d hits)\n", "searchSkipList", skipLookups,
+           skipTime * 1e9, skipHits);
+    printf("Speedup: %.0fx\n\n", linearTime / skipTime);
+
+    // Range scans of 1000 elements in each direction
+    int *buffer = (int*)malloc(sizeof(int) * 1000);
+    if (buffer == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    long long scanned = 0;
+    int scans = 10000;
+    start = getTimeSeconds();
+    for (int i = 0; i < scans; i++) {
+        int low = (int)(nextRandom(&state) % (2 * (uint64_t)n));
+        scanned += scanRange(&list, low, low + 1998, (i & 1) != 0, buffer, 1000);
+    }
+    double scanTime = getTimeSeconds() - start;
+    printf("Range scans: %d scans, %lld elements, %.1f ns/element (alternating forward/backward)\n",
+           scans, scanned, scanTime * 1e9 / (scanned > 0 ? scanned : 1));
+
+    // Deletes
+    start = getTimeSeconds();
+    int deletes = n / 10;
+    for (int i = 0; i < deletes; i++) {
+        deleteSkipList(&list, values[i]);
+    }
+    double deleteTime = getTimeSeconds() - start;
+    printf("Deletes: %d, %.0f ns/delete, %lld elements remain\n",
+           deletes, deletes > 0 ? deleteTime * 1e9 / deletes : 0.0, list.count);
+
+    // Verify order in both directions
+    bool sorted = true;
+    long long forward = 0, backward = 0;
+    for (SkipNode *node = list.header->next[0]; node != NULL; node = node->next[0]) {
+        if (node->next[0] != NULL && node->next[0]->data < node->data) {
+            sorted = false;
+        }
+        forward++;
+    }
+    for (SkipNode *node = list.tail; node != NULL; node = node->prev) {
+        backward++;
+    }
+    printf("Order check: %s (forward %lld, backward %lld nodes)\n",
+           (sorted && forward == list.count && backward == list.count) ? "OK" : "FAILED",
+           forward, backward);
+
+    free(buffer);
+    free(values);
+    freeList(head);
+    freeSkipList(&list);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  ORDERED SKIP LIST\n");
+    printf("  (doubly linked level 0 + express lanes)\n");
+    printf("=========================================\n\n");
+
+    SkipList list;
+    initSkipList(&list, 7);
+
+    int initial[] = {30, 10, 50, 20, 40, 35, 5, 60};
+    int numInitial = sizeof(initial) / sizeof(initial[0]);
+
+    printf("Inserting: ");
+    for (int i = 0; i < numInitial; i++) {
+        printf("%d ", initial[i]);
+        insertSkipList(&list, initial[i]);
+    }
+    printf("\n\n");
+    displaySkipList(&list);
+
+    printf("\nSearch 35: %s\n", searchSkipList(&list, 35) ? "found" : "not found");
+    printf("Search 36: %s\n", searchSkipList(&list, 36) ? "found" : "not found");
+
+    printf("\n");
+    displayRange(&list, 15, 45, false);
+    displayRange(&list, 15, 45, true);
+
+    printf("\nDeleting 35, 5 and 60 (middle, head, tail)\n");
+    deleteSkipList(&list, 35);
+    deleteSkipList(&list, 5);
+    deleteSkipList(&list, 60);
+    displaySkipList(&list);
+    displayRange(&list, 0, 100, true);
+    freeSkipList(&list);
+
+    int n = 10000000;
+    if (argc > 1) {
+        n = atoi(argv[1]);
+    }
+    // Keys are the even ints 0 .. 2n-2, and range scans reach 1998 past them
+    if (n < 1 || n > (INT_MAX - 2000) / 2) {
+        printf("Usage: %s [numElements]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Skip List vs findNode Benchmark:\n");
+    printf("-------------------------------------------");
+    runBenchmark(n, 20, 1000000);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
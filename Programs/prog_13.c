@@ -0,0 +1,727 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#define LOG_MAGIC 0x474F4C44u  // "DLOG"
+#define LOG_VERSION 1
+#define NUM_BUCKETS 40         // Latency buckets: [2^b, 2^(b+1)) nanoseconds
+
+// Operation types in an op-log (same operations as the Program 4 menu)
+typedef enum {
+    OP_INSERT_BEGIN,
+    OP_INSERT_END,
+    OP_INSERT_AFTER,
+    OP_INSERT_BEFORE,
+    OP_DELETE,
+    OP_COUNT,
+    NUM_OP_TYPES
+} OpType;
+
+// One logged operation; target is only used by insert-after/before
+typedef struct {
+    uint8_t type;
+    uint8_t padding[3];
+    int32_t target;
+    int32_t value;
+} Operation;
+
+// Binary op-log header
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t numOps;
+} LogHeader;
+
+// Node structure for doubly linked list (as in Program 4)
+typedef struct Node {
+    int data;
+    struct Node *prev;
+    struct Node *next;
+} Node;
+
+// List being replayed; tail and count are tracked so appends are O(1)
+typedef struct {
+    Node *head;
+    Node *tail;
+    long long count;
+} ReplayList;
+
+// Per-operation-type statistics
+typedef struct {
+    long long count;
+    long long failed;           // Target or value not found
+    long long totalNs;
+    long long maxNs;
+    long long buckets[NUM_BUCKETS];
+} OpStats;
+
+const char *opNames[NUM_OP_TYPES] = {
+    "insert-begin", "insert-end", "insert-after", "insert-before", "delete", "count"
+};
+
+// Get current time in nanoseconds from a monotonic clock
+static inline long long getTimeNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// ==================== LIST OPERATIONS (QUIET) ====================
+
+// Function to create a new node
+Node* createNode(int data) {
+    Node *newNode = (Node*)malloc(sizeof(Node));
+    if (newNode == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    newNode->data = data;
+    newNode->prev = NULL;
+    newNode->next = NULL;
+    return newNode;
+}
+
+// Function to insert at the beginning
+void insertAtBeginning(ReplayList *list, int data) {
+    Node *newNode = createNode(data);
+    newNode->next = list->head;
+    if (list->head != NULL) {
+        list->head->prev = newNode;
+    } else {
+        list->tail = newNode;
+    }
+    list->head = newNode;
+    list->count++;
+}
+
+// Function to insert at the end
+void insertAtEnd(ReplayList *list, int data) {
+    Node *newNode = createNode(data);
+    newNode->prev = list->tail;
+    if (list->tail != NULL) {
+        list->tail->next = newNode;
+    } else {
+        list->head = newNode;
+    }
+    list->tail = newNode;
+    list->count++;
+}
+
+// Function to find a node with given data (first match from the head)
+Node* findNode(ReplayList *list, int data) {
+    Node *temp = list->head;
+    while (temp != NULL) {
+        if (temp->data == data) {
+            return temp;
+        }
+        temp = temp->next;
+    }
+    return NULL;
+}
+
+// Function to insert after a given node; returns false if not found
+bool insertAfterNode(ReplayList *list, int targetData, int newData) {
+    Node *targetNode = findNode(list, targetData);
+    if (targetNode == NULL) {
+        return false;
+    }
+
+    Node *newNode = createNode(newData);
+    newNode->next = targetNode->next;
+    newNode->prev = targetNode;
+    if (targetNode->next != NULL) {
+        targetNode->next->prev = newNode;
+    } else {
+        list->tail = newNode;
+    }
+    targetNode->next = newNode;
+    list->count++;
+    return true;
+}
+
+// Function to insert before a given node; returns false if not found
+bool insertBeforeNode(ReplayList *list, int targetData, int newData) {
+    Node *targetNode = findNode(list, targetData);
+    if (targetNode == NULL) {
+        return false;
+    }
+
+    Node *newNode = createNode(newData);
+    newNode->prev = targetNode->prev;
+    newNode->next = targetNode;
+    if (targetNode->prev != NULL) {
+        targetNode->prev->next = newNode;
+    } else {
+        list->head = newNode;
+    }
+    targetNode->prev = newNode;
+    list->count++;
+    return true;
+}
+
+// Function to delete a specific node; returns false if not found
+bool deleteNode(ReplayList *list, int data) {
+    Node *targetNode = findNode(list, data);
+    if (targetNode == NULL) {
+        return false;
+    }
+
+    if (targetNode->prev != NULL) {
+        targetNode->prev->next = targetNode->next;
+    } else {
+        list->head = targetNode->next;
+    }
+    if (targetNode->next != NULL) {
+        targetNode->next->prev = targetNode->prev;
+    } else {
+        list->tail = targetNode->prev;
+    }
+
+    free(targetNode);
+    list->count--;
+    return true;
+}
+
+// Function to count nodes by walking the list (as Program 4 does)
+long long countNodes(ReplayList *list) {
+    long long count = 0;
+    for (Node *temp = list->head; temp != NULL; temp = temp->next) {
+        count++;
+    }
+    return count;
+}
+
+// Function to free the list
+void freeList(ReplayList *list) {
+    Node *temp;
+    while (list->head != NULL) {
+        temp = list->head;
+        list->head = list->head->next;
+        free(temp);
+    }
+    list->tail = NULL;
+    list->count = 0;
+}
+
+// ==================== OP-LOG READING AND WRITING ====================
+
+// Function to map an operation name to its type (-1 if unknown)
+int parseOpName(const char *name) {
+    for (int i = 0; i < NUM_OP_TYPES; i++) {
+        if (strcmp(name, opNames[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Function to append an operation to a growable array
+void appendOp(Operation **ops, long long *numOps, long long *capacity, Operation op) {
+    if (*numOps == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 1024;
+        Operation *grown = (Operation*)realloc(*ops, sizeof(Operation) * (*capacity));
+        if (grown == NULL) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        *ops = grown;
+    }
+    (*ops)[(*numOps)++] = op;
+}
+
+// Function to read a text op-log: one "name [target] value" per line, '#' comments
+Operation* readTextLog(FILE *file, long long *numOps) {
+    Operation *ops = NULL;
+    long long capacity = 0;
+    char line[256];
+    long long lineNumber = 0;
+    *numOps = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        lineNumber++;
+        char *cursor = line;
+        while (isspace((unsigned char)*cursor)) {
+            cursor++;
+        }
+        if (*cursor == '\0' || *cursor == '#') {
+            continue;
+        }
+
+        char name[32];
+        int a = 0, b = 0;
+        int fields = sscanf(cursor, "%31s %d %d", name, &a, &b);
+        int type = parseOpName(name);
+
+        int needed = (type == OP_INSERT_AFTER || type == OP_INSERT_BEFORE) ? 3
+                   : (type == OP_COUNT) ? 1 : 2;
+        if (type < 0 || fields < needed) {
+            printf("Line %lld: invalid operation: %s", lineNumber, line);
+            free(ops);
+            return NULL;
+        }
+
+        Operation op = {0};
+        op.type = (uint8_t)type;
+        if (needed == 3) {
+            op.target = a;
+            op.value = b;
+        } else {
+            op.value = a;
+        }
+        appendOp(&ops, numOps, &capacity, op);
+    }
+
+    // An empty log is valid; return an empty array rather than NULL
+    if (ops == NULL) {
+        ops = (Operation*)malloc(sizeof(Operation));
+        if (ops == NULL) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+    }
+    return ops;
+}
+
+// Function to read a binary op-log (header followed by fixed-size records)
+Operation* readBinaryLog(FILE *file, long long *numOps) {
+    LogHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != LOG_MAGIC ||
+        header.version != LOG_VERSION) {
+        printf("Invalid binary op-log header!\n");
+        return NULL;
+    }
+
+    // Check the record count against the file size before trusting it
+    long headerEnd = ftell(file);
+    long fileSize = -1;
+    if (headerEnd >= 0 && fseek(file, 0, SEEK_END) == 0) {
+        fileSize = ftell(file);
+    }
+    if (fileSize < headerEnd || fseek(file, headerEnd, SEEK_SET) != 0 ||
+        header.numOps > (uint64_t)(fileSize - headerEnd) / sizeof(Operation)) {
+        printf("Binary op-log is truncated!\n");
+        return NULL;
+    }
+
+    Operation *ops = (Operation*)malloc(sizeof(Operation) * (header.numOps ? header.numOps : 1));
+    if (ops == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    if (fread(ops, sizeof(Operation), header.numOps, file) != header.numOps) {
+        printf("Binary op-log is truncated!\n");
+        free(ops);
+        return NULL;
+    }
+    for (uint64_t i = 0; i < header.numOps; i++) {
+        if (ops[i].type >= NUM_OP_TYPES) {
+            printf("Record %llu: invalid operation type %d\n",
+                   (unsigned long long)i, ops[i].type);
+            free(ops);
+            return NULL;
+        }
+    }
+
+    *numOps = (long long)header.numOps;
+    return ops;
+}
+
+// Function to load an op-log, detecting binary logs by their magic number
+Operation* loadOpLog(const char *path, long long *numOps) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("Cannot open %s\n", path);
+        return NULL;
+    }
+
+    uint32_t magic = 0;
+    size_t got = fread(&magic, sizeof(magic), 1, file);
+    rewind(file);
+
+    Operation *ops = (got == 1 && magic == LOG_MAGIC) ? readBinaryLog(file, numOps)
+                                                      : readTextLog(file, numOps);
+    fclose(file);
+    return ops;
+}
+
+// Function to write an op-log in text or binary form
+bool writeOpLog(const char *path, Operation *ops, long long numOps, bool binary) {
+    FILE *file = fopen(path, binary ? "wb" : "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    bool ok = true;
+    if (binary) {
+        LogHeader header = {LOG_MAGIC, LOG_VERSION, (uint64_t)numOps};
+        ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(ops, sizeof(Operation), numOps, file) == (size_t)numOps;
+    } else {
+        fprintf(file, "# doubly linked list op-log: name [target] value\n");
+        for (long long i = 0; i < numOps && ok; i++) {
+            switch (ops[i].type) {
+                case OP_INSERT_AFTER:
+                case OP_INSERT_BEFORE:
+                    ok = fprintf(file, "%s %d %d\n", opNames[ops[i].type],
+                                 ops[i].target, ops[i].value) > 0;
+                    break;
+                case OP_COUNT:
+                    ok = fprintf(file, "%s\n", opNames[ops[i].type]) > 0;
+                    break;
+                default:
+                    ok = fprintf(file, "%s %d\n", opNames[ops[i].type], ops[i].value) > 0;
+            }
+        }
+    }
+
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    return ok;
+}
+
+// Function to generate a synthetic trace whose list size hovers near targetSize
+Operation* generateOpLog(long long numOps, int targetSize, uint64_t seed) {
+    Operation *ops = (Operation*)malloc(sizeof(Operation) * numOps);
+    int *live = (int*)malloc(sizeof(int) * (numOps + 1));
+    if (ops == NULL || live == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    uint64_t state = seed;
+    long long numLive = 0;
+    int nextValue = 1;
+
+    for (long long i = 0; i < numOps; i++) {
+        Operation op = {0};
+        int roll = (int)(nextRandom(&state) % 100);
+
+        int insertPercent = (numLive < targetSize) ? 70 : 30;
+
+        if (numLive == 0 || roll < insertPercent) {
+            int kind = (int)(nextRandom(&state) % 100);
+            if (numLive == 0 || kind < 40) {
+                op.type = (kind & 1) ? OP_INSERT_END : OP_INSERT_BEGIN;
+            } else if (kind < 75) {
+                op.type = OP_INSERT_AFTER;
+            } else {
+                op.type = OP_INSERT_BEFORE;
+            }
+        } else if (roll < 98) {
+            op.type = OP_DELETE;
+        } else {
+            op.type = OP_COUNT;
+        }
+
+        if (op.type == OP_DELETE) {
+            // Delete a random live value (swap-remove from the live set)
+            long long pick = (long long)(nextRandom(&state) % (uint64_t)numLive);
+            op.value = live[pick];
+            live[pick] = live[--numLive];
+        } else if (op.type != OP_COUNT) {
+            if (op.type == OP_INSERT_AFTER || op.type == OP_INSERT_BEFORE) {
+                op.target = live[nextRandom(&state) % (uint64_t)numLive];
+            }
+            op.value = nextValue++;
+            live[numLive++] = op.value;
+        }
+        ops[i] = op;
+    }
+
+    free(live);
+    return ops;
+}
+
+// ==================== REPLAY AND REPORT ====================
+
+// Function to place a latency in its log2 bucket
+static inline int latencyBucket(long long ns) {
+    int bucket = 0;
+    while (ns > 1 && bucket < NUM_BUCKETS - 1) {
+        ns >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// Function to apply one operation; returns false if its target or value was
+// not found
+static inline bool applyOp(ReplayList *list, Operation *op, long long *lastCount) {
+    switch (op->type) {
+        case OP_INSERT_BEGIN:
+            insertAtBeginning(list, op->value);
+            return true;
+        case OP_INSERT_END:
+            insertAtEnd(list, op->value);
+            return true;
+        case OP_INSERT_AFTER:
+            return insertAfterNode(list, op->target, op->value);
+        case OP_INSERT_BEFORE:
+            return insertBeforeNode(list, op->target, op->value);
+        case OP_DELETE:
+            return deleteNode(list, op->value);
+        case OP_COUNT:
+            *lastCount = countNodes(list);
+            return true;
+    }
+    return false;
+}
+
+// Function to apply every operation with no per-op timing; returns the wall
+// time in seconds. This is the pass throughput (ops/s) is taken from.
+double replayUntimed(ReplayList *list, Operation *ops, long long numOps, long long *lastCount) {
+    *lastCount = -1;
+    long long start = getTimeNs();
+    for (long long i = 0; i < numOps; i++) {
+        applyOp(list, &ops[i], lastCount);
+    }
+    return (getTimeNs() - start) / 1e9;
+}
+
+// Function to estimate what one getTimeNs() pair adds to a measured latency
+long long timerOverheadNs() {
+    const int samples = 100000;
+    long long start = getTimeNs();
+    for (int i = 0; i < samples; i++) {
+        (void)getTimeNs();
+    }
+    return (getTimeNs() - start) / samples;
+}
+
+// Function to apply every operation without printing, timing each one for
+// the latency histograms. Each latency includes one timer read's overhead.
+void replayOpLog(ReplayList *list, Operation *ops, long long numOps, OpStats stats[],
+                 long long *lastCount) {
+    memset(stats, 0, sizeof(OpStats) * NUM_OP_TYPES);
+    *lastCount = -1;
+
+    for (long long i = 0; i < numOps; i++) {
+        Operation *op = &ops[i];
+
+        long long before = getTimeNs();
+        bool ok = applyOp(list, op, lastCount);
+        long long elapsed = getTimeNs() - before;
+
+        OpStats *s = &stats[op->type];
+        s->count++;
+        s->totalNs += elapsed;
+        s->buckets[latencyBucket(elapsed)]++;
+        if (elapsed > s->maxNs) {
+            s->maxNs = elapsed;
+        }
+        if (!ok) {
+            s->failed++;
+        }
+    }
+}
+
+// Function to estimate a percentile from a histogram (upper edge of the bucket)
+long long histogramPercentile(OpStats *s, double fraction) {
+    long long wanted = (long long)(s->count * fraction);
+    long long seen = 0;
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        seen += s->buckets[b];
+        if (seen > wanted) {
+            return 1LL << (b + 1);
+        }
+    }
+    return s->maxNs;
+}
+
+// Function to print throughput, per-op latency summary and histograms
+void printReport(OpStats stats[], long long numOps, double seconds, long long overheadNs) {
+    printf("\nReplayed %lld operations in %.3f s: %.0f ops/s (untimed pass)\n", numOps, seconds,
+           numOps / seconds);
+    printf("Latencies below come from a second, per-op timed pass and include ~%lld ns of timer overhead\n\n",
+           overheadNs);
+
+    printf("%-14s %10s %8s %10s %9s %9s %10s\n",
+           "Operation", "Count", "Failed", "Mean ns", "p50 <=", "p99 <=", "Max ns");
+    printf("------------------------------------------------------------------------\n");
+    for (int t = 0; t < NUM_OP_TYPES; t++) {
+        OpStats *s = &stats[t];
+        if (s->count == 0) {
+            continue;
+        }
+        printf("%-14s %10lld %8lld %10.0f %9lld %9lld %10lld\n", opNames[t], s->count,
+               s->failed, (double)s->totalNs / s->count, histogramPercentile(s, 0.50),
+               histogramPercentile(s, 0.99), s->maxNs);
+    }
+
+    printf("\nLatency histograms (log2 buckets, # = 2%% of that operation):\n");
+    for (int t = 0; t < NUM_OP_TYPES; t++) {
+        OpStats *s = &stats[t];
+        if (s->count == 0) {
+            continue;
+        }
+        printf("\n%s:\n", opNames[t]);
+        for (int b = 0; b < NUM_BUCKETS; b++) {
+            if (s->buckets[b] == 0) {
+                continue;
+            }
+            int bars = (int)(50 * s->buckets[b] / s->count);
+            printf("  [%8lld, %8lld) ns %10lld  ", b == 0 ? 0 : 1LL << b, 1LL << (b + 1),
+                   s->buckets[b]);
+            for (int i = 0; i < bars; i++) {
+                printf("#");
+            }
+            printf("\n");
+        }
+    }
+}
+
+// Function to checksum the final list forward and verify it backward
+void printChecksums(ReplayList *list) {
+    uint64_t forwardHash = 1469598103934665603ULL;
+    long long forwardCount = 0;
+    for (Node *temp = list->head; temp != NULL; temp = temp->next) {
+        forwardHash = (forwardHash ^ (uint32_t)temp->data) * 1099511628211ULL;
+        forwardCount++;
+    }
+
+    // Hash the backward walk in reverse so it must match the forward hash
+    int *values = (int*)malloc(sizeof(int) * (forwardCount ? forwardCount : 1));
+    if (values == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    long long backwardCount = 0;
+    for (Node *temp = list->tail; temp != NULL && backwardCount < forwardCount; temp = temp->prev) {
+        values[forwardCount - 1 - backwardCount++] = temp->data;
+    }
+    uint64_t backwardHash = 1469598103934665603ULL;
+    for (long long i = 0; i < backwardCount; i++) {
+        backwardHash = (backwardHash ^ (uint32_t)values[i]) * 1099511628211ULL;
+    }
+    free(values);
+
+    printf("\nFinal list: %lld nodes\n", list->count);
+    printf("Forward checksum:  %016llx (%lld nodes)\n",
+           (unsigned long long)forwardHash, forwardCount);
+    printf("Backward checksum: %016llx (%lld nodes)\n",
+           (unsigned long long)backwardHash, backwardCount);
+    printf("Links %s\n", (forwardHash == backwardHash && forwardCount == backwardCount &&
+                          forwardCount == list->count) ? "consistent" : "INCONSISTENT");
+}
+
+// Function to load and replay one op-log file
+int replayFile(const char *path) {
+    long long numOps = 0;
+    Operation *ops = loadOpLog(path, &numOps);
+    if (ops == NULL) {
+        return 1;
+    }
+
+    printf("Loaded %lld operations from %s\n", numOps, path);
+
+    // Throughput from a pass with no timer calls, latencies from a fresh list
+    ReplayList list = {NULL, NULL, 0};
+    long long lastCount;
+    double seconds = replayUntimed(&list, ops, numOps, &lastCount);
+    freeList(&list);
+
+    OpStats stats[NUM_OP_TYPES];
+    replayOpLog(&list, ops, numOps, stats, &lastCount);
+
+    printReport(stats, numOps, seconds > 0 ? seconds : 1e-9, timerOverheadNs());
+    if (lastCount >= 0) {
+        printf("\nLast count operation returned %lld\n", lastCount);
+    }
+    printChecksums(&list);
+
+    freeList(&list);
+    free(ops);
+    return 0;
+}
+
+void printUsage(const char *program) {
+    printf("Usage:\n");
+    printf("  %s                                   run the demo\n", program);
+    printf("  %s replay <oplog>                    replay a text or binary op-log\n", program);
+    printf("  %s generate <oplog> <numOps> <listSize> [text|binary]\n", program);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  DOUBLY LINKED LIST OP-LOG REPLAY\n");
+    printf("=========================================\n\n");
+
+    if (argc >= 3 && strcmp(argv[1], "replay") == 0) {
+        return replayFile(argv[2]);
+    }
+
+    if (argc >= 5 && strcmp(argv[1], "generate") == 0) {
+        long long numOps = atoll(argv[3]);
+        int listSize = atoi(argv[4]);
+        bool binary = argc >= 6 && strcmp(argv[5], "binary") == 0;
+        if (numOps < 1 || listSize < 1) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        Operation *ops = generateOpLog(numOps, listSize, 42);
+        bool ok = writeOpLog(argv[2], ops, numOps, binary);
+        free(ops);
+        if (!ok) {
+            printf("Could not write %s\n", argv[2]);
+            return 1;
+        }
+        printf("Wrote %lld operations to %s (%s)\n", numOps, argv[2], binary ? "binary" : "text");
+        return 0;
+    }
+
+    if (argc > 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Demo: replay the Program 4 demonstration as a text log
+    const char *demoPath = "demo_oplog.txt";
+    FILE *file = fopen(demoPath, "w");
+    if (file == NULL) {
+        printf("Cannot create %s\n", demoPath);
+        return 1;
+    }
+    fprintf(file, "# Program 4 demonstration as an op-log\n");
+    fprintf(file, "insert-end 10\ninsert-end 20\ninsert-end 30\ninsert-end 40\ninsert-end 50\n");
+    fprintf(file, "insert-after 30 35\ninsert-after 50 60\ninsert-before 10 5\n");
+    fprintf(file, "delete 35\ndelete 5\ndelete 60\ndelete 99\ncount\n");
+    fclose(file);
+
+    printf("-------------------------------------------\n");
+    printf("Text op-log (Program 4 demonstration):\n");
+    printf("-------------------------------------------\n");
+    replayFile(demoPath);
+    remove(demoPath);
+
+    // Larger synthetic trace in binary form
+    const char *tracePath = "synthetic_oplog.bin";
+    long long numOps = 200000;
+    Operation *ops = generateOpLog(numOps, 2000, 42);
+    bool written = writeOpLog(tracePath, ops, numOps, true);
+    free(ops);
+
+    if (written) {
+        printf("\n-------------------------------------------\n");
+        printf("Binary op-log (synthetic, ~2000 live nodes):\n");
+        printf("-------------------------------------------\n");
+        replayFile(tracePath);
+    }
+    remove(tracePath);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
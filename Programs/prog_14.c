@@ -0,0 +1,688 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+
+#define MAX_THREADS 64
+#define VALUE_STRIDE 1000000   // Thread t owns values t*VALUE_STRIDE + k
+#define SPINS_BEFORE_YIELD 64
+
+// Node of the concurrent list: its own spinlock plus a logical-delete mark
+typedef struct CNode {
+    int data;
+    atomic_int lock;
+    atomic_bool marked;
+    _Atomic(struct CNode*) prev;
+    _Atomic(struct CNode*) next;
+} CNode;
+
+// Concurrent doubly linked list with head and tail sentinels
+typedef struct {
+    CNode *head;
+    CNode *tail;
+    atomic_long count;
+} ConcurrentList;
+
+// Node structure for doubly linked list (as in Program 4), used by the baseline
+typedef struct Node {
+    int data;
+    struct Node *prev;
+    struct Node *next;
+} Node;
+
+// Baseline: Program 4 list behind one global mutex
+typedef struct {
+    Node *head;
+    long count;
+    pthread_mutex_t mutex;
+} LockedList;
+
+// Deleted nodes are kept until no thread can still be traversing them
+typedef struct {
+    CNode **nodes;
+    long count;
+    long capacity;
+} RetireList;
+
+// Per-thread state for the stress test and benchmark
+typedef struct {
+    int id;
+    bool useLockedList;
+    ConcurrentList *list;
+    LockedList *lockedList;
+    long numOps;
+    uint64_t seed;
+    int *live;          // Values this thread has inserted and not deleted
+    long liveCount;
+    long nextSeq;
+    long failures;
+    RetireList retired;
+} Worker;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// ==================== SPINLOCK ====================
+
+// Test-and-test-and-set spinlock; yields so oversubscribed threads make progress
+void lockNode(CNode *node) {
+    int spins = 0;
+    while (atomic_exchange_explicit(&node->lock, 1, memory_order_acquire) != 0) {
+        while (atomic_load_explicit(&node->lock, memory_order_relaxed) != 0) {
+            if (++spins >= SPINS_BEFORE_YIELD) {
+                sched_yield();
+                spins = 0;
+            }
+        }
+    }
+}
+
+void unlockNode(CNode *node) {
+    atomic_store_explicit(&node->lock, 0, memory_order_release);
+}
+
+// ==================== CONCURRENT LIST FUNCTIONS ====================
+
+// Function to create a new node
+CNode* createCNode(int data) {
+    CNode *newNode = (CNode*)malloc(sizeof(CNode));
+    if (newNode == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    newNode->data = data;
+    atomic_init(&newNode->lock, 0);
+    atomic_init(&newNode->marked, false);
+    atomic_init(&newNode->prev, NULL);
+    atomic_init(&newNode->next, NULL);
+    return newNode;
+}
+
+void initConcurrentList(ConcurrentList *list) {
+    list->head = createCNode(0);
+    list->tail = createCNode(0);
+    atomic_store(&list->head->next, list->tail);
+    atomic_store(&list->tail->prev, list->head);
+    atomic_init(&list->count, 0);
+}
+
+// Function to record a deleted node for freeing later
+void retireNode(RetireList *retired, CNode *node) {
+    if (retired->count == retired->capacity) {
+        retired->capacity = retired->capacity ? retired->capacity * 2 : 256;
+        CNode **grown = (CNode**)realloc(retired->nodes, sizeof(CNode*) * retired->capacity);
+        if (grown == NULL) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        retired->nodes = grown;
+    }
+    retired->nodes[retired->count++] = node;
+}
+
+// Function to free retired nodes (only call when no thread is using the list)
+void freeRetired(RetireList *retired) {
+    for (long i = 0; i < retired->count; i++) {
+        free(retired->nodes[i]);
+    }
+    free(retired->nodes);
+    retired->nodes = NULL;
+    retired->count = 0;
+    retired->capacity = 0;
+}
+
+// Function to find a live node with given data without taking any locks
+CNode* findNode(ConcurrentList *list, int data) {
+    CNode *current = atomic_load_explicit(&list->head->next, memory_order_acquire);
+    while (current != list->tail) {
+        if (current->data == data &&
+            !atomic_load_explicit(&current->marked, memory_order_acquire)) {
+            return current;
+        }
+        current = atomic_load_explicit(&current->next, memory_order_acquire);
+    }
+    return NULL;
+}
+
+// Function to link newNode between two locked, adjacent nodes
+static void linkBetween(ConcurrentList *list, CNode *pred, CNode *succ, CNode *newNode) {
+    atomic_store_explicit(&newNode->prev, pred, memory_order_relaxed);
+    atomic_store_explicit(&newNode->next, succ, memory_order_relaxed);
+    // Publish the fully initialized node to lock-free readers
+    atomic_store_explicit(&pred->next, newNode, memory_order_release);
+    atomic_store_explicit(&succ->prev, newNode, memory_order_release);
+    atomic_fetch_add_explicit(&list->count, 1, memory_order_relaxed);
+}
+
+// Function to insert after a locked, unmarked node (locks its successor)
+static void insertAfterLocked(ConcurrentList *list, CNode *target, int newData) {
+    // target->next can only change while target is locked, so it is stable here
+    CNode *succ = atomic_load_explicit(&target->next, memory_order_acquire);
+    lockNode(succ);
+    linkBetween(list, target, succ, createCNode(newData));
+    unlockNode(succ);
+}
+
+// Function to insert at the beginning
+void insertAtBeginning(ConcurrentList *list, int data) {
+    lockNode(list->head);
+    insertAfterLocked(list, list->head, data);
+    unlockNode(list->head);
+}
+
+// Function to insert at the end
+void insertAtEnd(ConcurrentList *list, int data) {
+    while (true) {
+        CNode *pred = atomic_load_explicit(&list->tail->prev, memory_order_acquire);
+        lockNode(pred);
+        // Validate: pred is still live and still directly before the tail
+        if (!atomic_load_explicit(&pred->marked, memory_order_acquire) &&
+            atomic_load_explicit(&pred->next, memory_order_acquire) == list->tail) {
+            lockNode(list->tail);
+            linkBetween(list, pred, list->tail, createCNode(data));
+            unlockNode(list->tail);
+            unlockNode(pred);
+            return;
+        }
+        unlockNode(pred);
+    }
+}
+
+// Function to insert after a given node; returns false if not found
+bool insertAfterNode(ConcurrentList *list, int targetData, int newData) {
+    while (true) {
+        CNode *target = findNode(list, targetData);
+        if (target == NULL) {
+            return false;
+        }
+
+        lockNode(target);
+        if (!atomic_load_explicit(&target->marked, memory_order_acquire)) {
+            insertAfterLocked(list, target, newData);
+            unlockNode(target);
+            return true;
+        }
+        // Deleted between the search and the lock; search again
+        unlockNode(target);
+    }
+}
+
+// Function to insert before a given node; returns false if not found
+bool insertBeforeNode(ConcurrentList *list, int targetData, int newData) {
+    while (true) {
+        CNode *target = findNode(list, targetData);
+        if (target == NULL) {
+            return false;
+        }
+
+        CNode *pred = atomic_load_explicit(&target->prev, memory_order_acquire);
+        lockNode(pred);
+        if (!atomic_load_explicit(&pred->marked, memory_order_acquire) &&
+            atomic_load_explicit(&pred->next, memory_order_acquire) == target) {
+            lockNode(target);
+            if (!atomic_load_explicit(&target->marked, memory_order_acquire)) {
+                linkBetween(list, pred, target, createCNode(newData));
+                unlockNode(target);
+                unlockNode(pred);
+                return true;
+            }
+            unlockNode(target);
+        }
+        unlockNode(pred);
+    }
+}
+
+// Function to delete a specific node; returns false if not found
+bool deleteNode(ConcurrentList *list, int data, RetireList *retired) {
+    while (true) {
+        CNode *target = findNode(list, data);
+        if (target == NULL) {
+            return false;
+        }
+
+        // Lock pred, target and succ in list order (no deadlock possible)
+        CNode *pred = atomic_load_explicit(&target->prev, memory_order_acquire);
+        lockNode(pred);
+        if (atomic_load_explicit(&pred->marked, memory_order_acquire) ||
+            atomic_load_explicit(&pred->next, memory_order_acquire) != target) {
+            unlockNode(pred);
+            continue;
+        }
+
+        lockNode(target);
+        if (atomic_load_explicit(&target->marked, memory_order_acquire)) {
+            unlockNode(target);
+            unlockNode(pred);
+            continue;
+        }
+
+        CNode *succ = atomic_load_explicit(&target->next, memory_order_acquire);
+        lockNode(succ);
+
+        // Logical delete first, then unlink; target->next stays valid for readers
+        atomic_store_explicit(&target->marked, true, memory_order_release);
+        atomic_store_explicit(&pred->next, succ, memory_order_release);
+        atomic_store_explicit(&succ->prev, pred, memory_order_release);
+        atomic_fetch_sub_explicit(&list->count, 1, memory_order_relaxed);
+
+        unlockNode(succ);
+        unlockNode(target);
+        unlockNode(pred);
+
+        retireNode(retired, target);
+        return true;
+    }
+}
+
+// Function to display list forward (call only when no writers are running)
+void displayForward(ConcurrentList *list) {
+    printf("Forward: HEAD <-> ");
+    for (CNode *node = atomic_load(&list->head->next); node != list->tail;
+         node = atomic_load(&node->next)) {
+        printf("%d <-> ", node->data);
+    }
+    printf("TAIL\n");
+}
+
+// Function to display list backward (call only when no writers are running)
+void displayBackward(ConcurrentList *list) {
+    printf("Backward: TAIL <-> ");
+    for (CNode *node = atomic_load(&list->tail->prev); node != list->head;
+         node = atomic_load(&node->prev)) {
+        printf("%d <-> ", node->data);
+    }
+    printf("HEAD\n");
+}
+
+// Function to check links and marks after all threads have finished
+bool verifyList(ConcurrentList *list, long *nodesOut) {
+    long nodes = 0;
+    CNode *prev = list->head;
+    CNode *node = atomic_load(&list->head->next);
+
+    while (node != NULL && node != list->tail) {
+        if (atomic_load(&node->marked) || atomic_load(&node->prev) != prev ||
+            atomic_load(&node->lock) != 0) {
+            return false;
+        }
+        nodes++;
+        prev = node;
+        node = atomic_load(&node->next);
+    }
+
+    *nodesOut = nodes;
+    return node == list->tail && atomic_load(&list->tail->prev) == prev &&
+           nodes == atomic_load(&list->count);
+}
+
+// Function to free the list
+void freeConcurrentList(ConcurrentList *list) {
+    CNode *node = list->head;
+    while (node != NULL) {
+        CNode *next = (node == list->tail) ? NULL : atomic_load(&node->next);
+        free(node);
+        node = next;
+    }
+}
+
+// ==================== BASELINE: GLOBAL MUTEX ====================
+
+Node* createNode(int data) {
+    Node *newNode = (Node*)malloc(sizeof(Node));
+    if (newNode == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    newNode->data = data;
+    newNode->prev = NULL;
+    newNode->next = NULL;
+    return newNode;
+}
+
+Node* findLockedNode(Node *head, int data) {
+    for (Node *temp = head; temp != NULL; temp = temp->next) {
+        if (temp->data == data) {
+            return temp;
+        }
+    }
+    return NULL;
+}
+
+bool lockedInsertAfter(LockedList *list, int targetData, int newData) {
+    pthread_mutex_lock(&list->mutex);
+    Node *target = findLockedNode(list->head, targetData);
+    if (target != NULL) {
+        Node *newNode = createNode(newData);
+        newNode->next = target->next;
+        newNode->prev = target;
+        if (target->next != NULL) {
+            target->next->prev = newNode;
+        }
+        target->next = newNode;
+        list->count++;
+    }
+    pthread_mutex_unlock(&list->mutex);
+    return target != NULL;
+}
+
+bool lockedDelete(LockedList *list, int data) {
+    pthread_mutex_lock(&list->mutex);
+    Node *target = findLockedNode(list->head, data);
+    if (target != NULL) {
+        if (target->prev != NULL) {
+            target->prev->next = target->next;
+        } else {
+            list->head = target->next;
+        }
+        if (target->next != NULL) {
+            target->next->prev = target->prev;
+        }
+        free(target);
+        list->count--;
+    }
+    pthread_mutex_unlock(&list->mutex);
+    return target != NULL;
+}
+
+void freeLockedList(LockedList *list) {
+    while (list->head != NULL) {
+        Node *temp = list->head;
+        list->head = temp->next;
+        free(temp);
+    }
+    pthread_mutex_destroy(&list->mutex);
+}
+
+// ==================== WORKLOAD ====================
+
+// Each thread inserts after / deletes its own values, so threads work on
+// disjoint regions of the list (every thread starts from its own anchor)
+void* workerThread(void *arg) {
+    Worker *w = (Worker*)arg;
+    int anchor = w->id * VALUE_STRIDE;
+
+    for (long i = 0; i < w->numOps; i++) {
+        uint64_t roll = nextRandom(&w->seed);
+        bool doInsert = w->liveCount < 8 || (roll & 1);
+
+        if (doInsert) {
+            int target = (w->liveCount > 0 && (roll & 6))
+                       ? w->live[(roll >> 8) % w->liveCount] : anchor;
+            int value = anchor + 1 + (int)(w->nextSeq++ % (VALUE_STRIDE - 1));
+            bool ok;
+
+            if (w->useLockedList) {
+                ok = lockedInsertAfter(w->lockedList, target, value);
+            } else if (target != anchor && (roll & 0x30) == 0) {
+                // The anchor always stays the first node of this thread's region
+                ok = insertBeforeNode(w->list, target, value);
+            } else {
+                ok = insertAfterNode(w->list, target, value);
+            }
+
+            if (ok) {
+                w->live[w->liveCount++] = value;
+            } else {
+                w->failures++;
+            }
+        } else {
+            long pick = (long)((roll >> 8) % w->liveCount);
+            int value = w->live[pick];
+            bool ok = w->useLockedList ? lockedDelete(w->lockedList, value)
+                                       : deleteNode(w->list, value, &w->retired);
+            if (ok) {
+                w->live[pick] = w->live[--w->liveCount];
+            } else {
+                w->failures++;
+            }
+        }
+    }
+    return NULL;
+}
+
+// Function to run numThreads workers; returns elapsed seconds
+double runWorkers(Worker workers[], int numThreads) {
+    pthread_t threads[MAX_THREADS];
+
+    double start = getTimeSeconds();
+    for (int t = 0; t < numThreads; t++) {
+        if (pthread_create(&threads[t], NULL, workerThread, &workers[t]) != 0) {
+            printf("Thread creation failed!\n");
+            exit(1);
+        }
+    }
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return getTimeSeconds() - start;
+}
+
+// Function to prepare workers and the list anchors for one run
+void setupWorkers(Worker workers[], int numThreads, long opsPerThread, bool useLockedList,
+                  ConcurrentList *list, LockedList *lockedList, int fillerPerThread) {
+    for (int t = 0; t < numThreads; t++) {
+        Worker *w = &workers[t];
+        w->id = t;
+        w->useLockedList = useLockedList;
+        w->list = list;
+        w->lockedList = lockedList;
+        w->numOps = opsPerThread;
+        w->seed = 0x9E3779B97F4A7C15ULL * (t + 1);
+        w->live = (int*)malloc(sizeof(int) * (opsPerThread + fillerPerThread + 1));
+        if (w->live == NULL) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        w->liveCount = 0;
+        w->nextSeq = 0;
+        w->failures = 0;
+        w->retired.nodes = NULL;
+        w->retired.count = 0;
+        w->retired.capacity = 0;
+    }
+
+    // Anchors in thread order, each followed by some filler values
+    Node *lockedTail = NULL;
+    for (int t = 0; t < numThreads; t++) {
+        for (int k = 0; k <= fillerPerThread; k++) {
+            int value = t * VALUE_STRIDE + (k == 0 ? 0 : (int)(workers[t].nextSeq++ + 1));
+            if (useLockedList) {
+                Node *node = createNode(value);
+                node->prev = lockedTail;
+                if (lockedTail != NULL) {
+                    lockedTail->next = node;
+                } else {
+                    lockedList->head = node;
+                }
+                lockedTail = node;
+                lockedList->count++;
+            } else {
+                insertAtEnd(list, value);
+            }
+            if (k > 0) {
+                workers[t].live[workers[t].liveCount++] = value;
+            }
+        }
+    }
+}
+
+// Function to release per-thread state
+void cleanupWorkers(Worker workers[], int numThreads) {
+    for (int t = 0; t < numThreads; t++) {
+        free(workers[t].live);
+        freeRetired(&workers[t].retired);
+    }
+}
+
+// Function to run the stress test and check the final list
+bool stressTest(int numThreads, long opsPerThread) {
+    ConcurrentList list;
+    initConcurrentList(&list);
+    Worker workers[MAX_THREADS];
+    setupWorkers(workers, numThreads, opsPerThread, false, &list, NULL, 16);
+
+    double seconds = runWorkers(workers, numThreads);
+
+    long nodes = 0;
+    bool linksOk = verifyList(&list, &nodes);
+
+    // Every thread's live set must be exactly what is in its region
+    long expected = numThreads;  // anchors
+    long failures = 0;
+    long *perThread = (long*)calloc(numThreads, sizeof(long));
+    for (CNode *node = atomic_load(&list.head->next); node != list.tail;
+         node = atomic_load(&node->next)) {
+        int owner = node->data / VALUE_STRIDE;
+        if (owner >= 0 && owner < numThreads && node->data % VALUE_STRIDE != 0) {
+            perThread[owner]++;
+        }
+    }
+    bool setsOk = true;
+    for (int t = 0; t < numThreads; t++) {
+        expected += workers[t].liveCount;
+        failures += workers[t].failures;
+        if (perThread[t] != workers[t].liveCount) {
+            setsOk = false;
+        }
+    }
+    free(perThread);
+
+    bool ok = linksOk && setsOk && nodes == expected && failures == 0;
+    printf("Stress %2d threads x %ld ops: %.2f s, %ld nodes (expected %ld), "
+           "links %s, per-thread sets %s, failed ops %ld -> %s\n",
+           numThreads, opsPerThread, seconds, nodes, expected,
+           linksOk ? "OK" : "BROKEN", setsOk ? "OK" : "WRONG", failures, ok ? "PASS" : "FAIL");
+
+    cleanupWorkers(workers, numThreads);
+    freeConcurrentList(&list);
+    return ok;
+}
+
+// Function to measure throughput of both designs for a thread count
+void scalingRun(int numThreads, long totalOps, int fillerPerThread, double baseline[2]) {
+    long opsPerThread = totalOps / numThreads;
+    double throughput[2];
+
+    for (int mode = 0; mode < 2; mode++) {
+        bool useLocked = (mode == 0);
+        ConcurrentList list;
+        LockedList lockedList;
+        if (useLocked) {
+            lockedList.head = NULL;
+            lockedList.count = 0;
+            pthread_mutex_init(&lockedList.mutex, NULL);
+        } else {
+            initConcurrentList(&list);
+        }
+
+        Worker workers[MAX_THREADS];
+        setupWorkers(workers, numThreads, opsPerThread, useLocked, &list, &lockedList,
+                     fillerPerThread);
+        double seconds = runWorkers(workers, numThreads);
+        throughput[mode] = (double)opsPerThread * numThreads / seconds;
+
+        cleanupWorkers(workers, numThreads);
+        if (useLocked) {
+            freeLockedList(&lockedList);
+        } else {
+            freeConcurrentList(&list);
+        }
+    }
+
+    if (baseline[0] == 0) {
+        baseline[0] = throughput[0];
+        baseline[1] = throughput[1];
+    }
+    printf("%7d %16.0f %8.2fx %16.0f %8.2fx %9.2fx\n", numThreads,
+           throughput[0], throughput[0] / baseline[0],
+           throughput[1], throughput[1] / baseline[1], throughput[1] / throughput[0]);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  CONCURRENT DOUBLY LINKED LIST\n");
+    printf("  (per-node spinlocks, lazy list)\n");
+    printf("=========================================\n\n");
+
+    // Single-threaded demonstration of the same operations as Program 4
+    ConcurrentList demo;
+    initConcurrentList(&demo);
+    RetireList retired = {NULL, 0, 0};
+
+    insertAtEnd(&demo, 10);
+    insertAtEnd(&demo, 20);
+    insertAtEnd(&demo, 30);
+    insertAtEnd(&demo, 40);
+    insertAtEnd(&demo, 50);
+    displayForward(&demo);
+
+    insertAfterNode(&demo, 30, 35);
+    insertBeforeNode(&demo, 10, 5);
+    insertAtBeginning(&demo, 1);
+    printf("After insertAfter(30, 35), insertBefore(10, 5), insertAtBeginning(1):\n");
+    displayForward(&demo);
+
+    deleteNode(&demo, 35, &retired);
+    deleteNode(&demo, 1, &retired);
+    deleteNode(&demo, 50, &retired);
+    printf("After deleting 35, 1 and 50:\n");
+    displayForward(&demo);
+    displayBackward(&demo);
+    printf("Count: %ld\n", atomic_load(&demo.count));
+    freeRetired(&retired);
+    freeConcurrentList(&demo);
+
+    int maxThreads = 32;
+    long totalOps = 400000;
+    if (argc > 1) {
+        maxThreads = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        totalOps = atol(argv[2]);
+    }
+    if (maxThreads < 1 || maxThreads > MAX_THREADS || totalOps < maxThreads) {
+        printf("Usage: %s [maxThreads 1-%d] [totalOps]\n", argv[0], MAX_THREADS);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Stress Test:\n");
+    printf("-------------------------------------------\n");
+    bool allPassed = true;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        allPassed = stressTest(threads, 20000) && allPassed;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Scaling Benchmark (%ld ops total, insert-after/delete mix):\n", totalOps);
+    printf("-------------------------------------------\n");
+    printf("Online CPUs: %ld\n\n", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%7s %16s %9s %16s %9s %10s\n", "Threads", "Global mutex", "Scaling",
+           "Per-node locks", "Scaling", "vs mutex");
+    printf("-------------------------------------------------------------------------\n");
+    double baseline[2] = {0, 0};
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        scalingRun(threads, totalOps, 512 / threads + 8, baseline);
+    }
+
+    printf("\n%s\n", allPassed ? "All stress tests passed." : "STRESS TEST FAILURES!");
+    printf("\nProgram completed successfully!\n");
+    return allPassed ? 0 : 1;
+}
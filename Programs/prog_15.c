@@ -0,0 +1,393 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Graph in compressed sparse row form: the neighbors of vertex v are
+// neighbors[rowOffsets[v]] .. neighbors[rowOffsets[v + 1] - 1], in ascending order
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== CSR CONSTRUCTION ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to sort a short neighbor list in place
+static void sortNeighbors(int *list, long long length) {
+    if (length > 32) {
+        qsort(list, length, sizeof(int), compareInts);
+        return;
+    }
+    for (long long i = 1; i < length; i++) {
+        int key = list[i];
+        long long j = i - 1;
+        while (j >= 0 && list[j] > key) {
+            list[j + 1] = list[j];
+            j--;
+        }
+        list[j + 1] = key;
+    }
+}
+
+// Function to build a CSR graph from an edge list in O(V + E)
+// (plus sorting each neighbor list). Duplicate edges are merged, as setting
+// the same adjacency matrix cell twice would.
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges, bool undirected) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    g->numVertices = numVertices;
+    g->rowOffsets = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+
+    for (int v = 0; v <= numVertices; v++) {
+        g->rowOffsets[v] = 0;
+    }
+
+    // Count degrees (shifted by one so the prefix sum gives start offsets)
+    long long skipped = 0;
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u < 0 || v < 0 || u >= numVertices || v >= numVertices) {
+            skipped++;
+            continue;
+        }
+        g->rowOffsets[u + 1]++;
+        if (undirected && u != v) {
+            g->rowOffsets[v + 1]++;
+        }
+    }
+    if (skipped > 0) {
+        printf("Skipped %lld edges with invalid vertices!\n", skipped);
+    }
+
+    for (int v = 0; v < numVertices; v++) {
+        g->rowOffsets[v + 1] += g->rowOffsets[v];
+    }
+
+    // Scatter edges into their rows
+    long long total = g->rowOffsets[numVertices];
+    g->neighbors = (int*)allocOrExit(sizeof(int) * (total > 0 ? total : 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    for (int v = 0; v <= numVertices; v++) {
+        cursor[v] = g->rowOffsets[v];
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u < 0 || v < 0 || u >= numVertices || v >= numVertices) {
+            continue;
+        }
+        g->neighbors[cursor[u]++] = v;
+        if (undirected && u != v) {
+            g->neighbors[cursor[v]++] = u;
+        }
+    }
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = g->rowOffsets[v];
+        long long end = g->rowOffsets[v + 1];
+        sortNeighbors(g->neighbors + start, end - start);
+
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || g->neighbors[i] != g->neighbors[i - 1]) {
+                g->neighbors[write++] = g->neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+
+    free(g->rowOffsets);
+    g->rowOffsets = cursor;
+    g->numEdges = write;
+    return g;
+}
+
+// Function to free a CSR graph
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+// Function to display each vertex's neighbor list
+void displayCSR(CSRGraph *g) {
+    printf("\nCSR Adjacency (vertex: neighbors):\n");
+    for (int v = 0; v < g->numVertices; v++) {
+        printf("%2d:", v);
+        for (long long i = g->rowOffsets[v]; i < g->rowOffsets[v + 1]; i++) {
+            printf(" %d", g->neighbors[i]);
+        }
+        printf("\n");
+    }
+    printf("rowOffsets:");
+    for (int v = 0; v <= g->numVertices; v++) {
+        printf(" %lld", g->rowOffsets[v]);
+    }
+    printf("\n");
+}
+
+// ==================== TRAVERSALS ====================
+
+// BFS traversal; writes the visit order and returns the number of vertices reached
+int BFS(CSRGraph *g, int startVertex, int order[]) {
+    bool *visited = (bool*)calloc(g->numVertices, sizeof(bool));
+    if (visited == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    // The order array doubles as the queue: head reads, tail appends
+    int head = 0;
+    int tail = 0;
+    visited[startVertex] = true;
+    order[tail++] = startVertex;
+
+    while (head < tail) {
+        int currentVertex = order[head++];
+        for (long long i = g->rowOffsets[currentVertex]; i < g->rowOffsets[currentVertex + 1]; i++) {
+            int neighbor = g->neighbors[i];
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                order[tail++] = neighbor;
+            }
+        }
+    }
+
+    free(visited);
+    return tail;
+}
+
+// DFS traversal (recursive); depth is bounded by the call stack, so use
+// DFSIterative for large graphs
+void DFSRecursive(CSRGraph *g, int vertex, bool visited[], int order[], int *count) {
+    visited[vertex] = true;
+    order[(*count)++] = vertex;
+
+    for (long long i = g->rowOffsets[vertex]; i < g->rowOffsets[vertex + 1]; i++) {
+        if (!visited[g->neighbors[i]]) {
+            DFSRecursive(g, g->neighbors[i], visited, order, count);
+        }
+    }
+}
+
+// DFS wrapper function
+int DFS(CSRGraph *g, int startVertex, int order[]) {
+    bool *visited = (bool*)calloc(g->numVertices, sizeof(bool));
+    if (visited == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    int count = 0;
+    DFSRecursive(g, startVertex, visited, order, &count);
+    free(visited);
+    return count;
+}
+
+// DFS iterative using an explicit stack; a vertex is expanded only when it
+// is first visited, so at most E + 1 entries are ever pushed
+int DFSIterative(CSRGraph *g, int startVertex, int order[]) {
+    bool *visited = (bool*)calloc(g->numVertices, sizeof(bool));
+    int *stack = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+    if (visited == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    long long top = 0;
+    int count = 0;
+    stack[top++] = startVertex;
+
+    while (top > 0) {
+        int currentVertex = stack[--top];
+        if (visited[currentVertex]) {
+            continue;
+        }
+        visited[currentVertex] = true;
+        order[count++] = currentVertex;
+
+        // Push in reverse so the smallest neighbor is explored first
+        for (long long i = g->rowOffsets[currentVertex + 1] - 1; i >= g->rowOffsets[currentVertex]; i--) {
+            if (!visited[g->neighbors[i]]) {
+                stack[top++] = g->neighbors[i];
+            }
+        }
+    }
+
+    free(stack);
+    free(visited);
+    return count;
+}
+
+// Check if graph is connected (BFS from vertex 0 reaches every vertex)
+bool isConnected(CSRGraph *g) {
+    if (g->numVertices == 0) {
+        return true;
+    }
+    int *order = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    int reached = BFS(g, 0, order);
+    free(order);
+    return reached == g->numVertices;
+}
+
+// Function to print a traversal order
+void printTraversal(const char *name, int startVertex, int order[], int count) {
+    printf("\n%s starting from vertex %d:\n", name, startVertex);
+    for (int i = 0; i < count; i++) {
+        printf("%d ", order[i]);
+    }
+    printf("\n");
+}
+
+// ==================== BENCHMARK ====================
+
+// Function to generate numEdges random undirected edges (deterministic)
+Edge* randomEdges(int numVertices, long long numEdges, uint64_t seed) {
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seed;
+    for (long long e = 0; e < numEdges; e++) {
+        uint64_t r = nextRandom(&state);
+        edges[e].src = (int)((r & 0xFFFFFFFFu) % (uint64_t)numVertices);
+        edges[e].dest = (int)((r >> 32) % (uint64_t)numVertices);
+    }
+    return edges;
+}
+
+void runBenchmark(int numVertices, long long numEdges) {
+    printf("\nGenerating %lld random undirected edges over %d vertices...\n", numEdges, numVertices);
+    Edge *edges = randomEdges(numVertices, numEdges, 7);
+
+    double start = getTimeSeconds();
+    CSRGraph *g = buildCSR(numVertices, edges, numEdges, true);
+    double buildTime = getTimeSeconds() - start;
+    free(edges);
+
+    double csrBytes = sizeof(long long) * (g->numVertices + 1.0) + sizeof(int) * (double)g->numEdges;
+    double matrixBytes = (double)numVertices * numVertices * sizeof(int);
+    printf("CSR built in %.2f s: %lld adjacency entries, %.1f MB "
+           "(an int adjacency matrix would need %.1f GB)\n\n",
+           buildTime, g->numEdges, csrBytes / (1024 * 1024), matrixBytes / (1024.0 * 1024 * 1024));
+
+    int *order = (int*)allocOrExit(sizeof(int) * numVertices);
+
+    printf("%-16s %10s %12s %14s\n", "Traversal", "Seconds", "Reached", "Edges/second");
+    printf("------------------------------------------------------\n");
+
+    start = getTimeSeconds();
+    int reached = BFS(g, 0, order);
+    double t = getTimeSeconds() - start;
+    printf("%-16s %10.3f %12d %14.0f\n", "BFS", t, reached, g->numEdges / t);
+
+    start = getTimeSeconds();
+    reached = DFSIterative(g, 0, order);
+    t = getTimeSeconds() - start;
+    printf("%-16s %10.3f %12d %14.0f\n", "DFSIterative", t, reached, g->numEdges / t);
+
+    start = getTimeSeconds();
+    bool connected = isConnected(g);
+    t = getTimeSeconds() - start;
+    printf("%-16s %10.3f %12s %14.0f\n", "isConnected", t, connected ? "yes" : "no", g->numEdges / t);
+
+    free(order);
+    freeCSR(g);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  GRAPH TRAVERSAL (BFS & DFS)\n");
+    printf("  Using Compressed Sparse Row (CSR)\n");
+    printf("=========================================\n\n");
+
+    // Same example graph as Program 5
+    printf("Creating example graph with 6 vertices:\n\n");
+    printf("Graph Structure:\n");
+    printf("    0 --- 1 --- 2\n");
+    printf("    |     |     |\n");
+    printf("    3 --- 4 --- 5\n");
+
+    Edge demoEdges[] = {{0, 1}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {4, 5}};
+    CSRGraph *g = buildCSR(6, demoEdges, sizeof(demoEdges) / sizeof(demoEdges[0]), true);
+    displayCSR(g);
+
+    int order[6];
+    int count;
+
+    count = BFS(g, 0, order);
+    printTraversal("BFS Traversal", 0, order, count);
+    count = BFS(g, 2, order);
+    printTraversal("BFS Traversal", 2, order, count);
+
+    count = DFS(g, 0, order);
+    printTraversal("DFS Traversal (Recursive)", 0, order, count);
+    count = DFS(g, 2, order);
+    printTraversal("DFS Traversal (Recursive)", 2, order, count);
+
+    count = DFSIterative(g, 0, order);
+    printTraversal("DFS Traversal (Iterative)", 0, order, count);
+
+    printf("\nGraph is %s\n", isConnected(g) ? "connected" : "not connected");
+    freeCSR(g);
+
+    // Large sparse graph
+    int numVertices = 1000000;
+    long long numEdges = 8000000;
+    if (argc > 1) {
+        numVertices = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        numEdges = atoll(argv[2]);
+    }
+    if (numVertices < 1 || numEdges < 0) {
+        printf("Usage: %s [numVertices] [numEdges]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Large Graph Benchmark:\n");
+    printf("-------------------------------------------");
+    runBenchmark(numVertices, numEdges);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,382 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Rows are padded to a multiple of 4 words (32 bytes) so the AVX2 path can
+// use aligned 256-bit loads; the padding bits are always zero
+#define WORD_BITS 64
+#define ROW_ALIGN_WORDS 4
+
+// Dense graph using a bit-packed adjacency matrix: bit (i, j) is set when
+// there is an edge between i and j
+typedef struct {
+    int numVertices;
+    int wordsPerRow;
+    uint64_t *bits;
+} BitGraph;
+
+// Graph using an int adjacency matrix, as in Program 5 but heap-allocated
+typedef struct {
+    int numVertices;
+    int *adjMatrix;
+} IntGraph;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// Function to allocate a zeroed, 32-byte aligned array of words
+uint64_t* allocWords(size_t numWords) {
+    size_t bytes = numWords * sizeof(uint64_t);
+    bytes = (bytes + 31) / 32 * 32;
+    uint64_t *words = (uint64_t*)aligned_alloc(32, bytes > 0 ? bytes : 32);
+    if (words == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    memset(words, 0, bytes);
+    return words;
+}
+
+// ==================== BIT MATRIX ====================
+
+// Initialize bit graph with no edges
+BitGraph* createBitGraph(int vertices) {
+    BitGraph *g = (BitGraph*)malloc(sizeof(BitGraph));
+    if (g == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    int words = (vertices + WORD_BITS - 1) / WORD_BITS;
+    g->numVertices = vertices;
+    g->wordsPerRow = (words + ROW_ALIGN_WORDS - 1) / ROW_ALIGN_WORDS * ROW_ALIGN_WORDS;
+    g->bits = allocWords((size_t)vertices * g->wordsPerRow);
+    return g;
+}
+
+void freeBitGraph(BitGraph *g) {
+    free(g->bits);
+    free(g);
+}
+
+static inline uint64_t* bitRow(BitGraph *g, int vertex) {
+    return g->bits + (size_t)vertex * g->wordsPerRow;
+}
+
+static inline bool hasEdge(BitGraph *g, int src, int dest) {
+    return (bitRow(g, src)[dest / WORD_BITS] >> (dest % WORD_BITS)) & 1;
+}
+
+// Add edge to undirected graph
+void addEdge(BitGraph *g, int src, int dest) {
+    if (src >= g->numVertices || dest >= g->numVertices || src < 0 || dest < 0) {
+        printf("Invalid vertices!\n");
+        return;
+    }
+    bitRow(g, src)[dest / WORD_BITS] |= 1ULL << (dest % WORD_BITS);
+    bitRow(g, dest)[src / WORD_BITS] |= 1ULL << (src % WORD_BITS);
+}
+
+// Display adjacency matrix
+void displayGraph(BitGraph *g) {
+    printf("\nAdjacency Matrix (bits):\n");
+    printf("   ");
+    for (int i = 0; i < g->numVertices; i++) {
+        printf("%2d ", i);
+    }
+    printf("\n");
+
+    for (int i = 0; i < g->numVertices; i++) {
+        printf("%2d: ", i);
+        for (int j = 0; j < g->numVertices; j++) {
+            printf("%2d ", hasEdge(g, i, j) ? 1 : 0);
+        }
+        printf("  word 0 = 0x%02llx\n", (unsigned long long)bitRow(g, i)[0]);
+    }
+}
+
+// Function to append every set bit of a word to the queue, lowest first
+static inline int appendBits(uint64_t bits, int base, int *queue, int tail) {
+    while (bits != 0) {
+        queue[tail++] = base + __builtin_ctzll(bits);
+        bits &= bits - 1;
+    }
+    return tail;
+}
+
+// Function to enqueue the unvisited neighbors of a vertex: computes
+// row & ~visited a word (or four words) at a time and marks them visited
+static inline int expandRow(const uint64_t *row, uint64_t *visited, int words, int *queue, int tail) {
+    int w = 0;
+#ifdef __AVX2__
+    for (; w + 4 <= words; w += 4) {
+        __m256i r = _mm256_load_si256((const __m256i*)(row + w));
+        __m256i v = _mm256_load_si256((const __m256i*)(visited + w));
+        __m256i fresh = _mm256_andnot_si256(v, r);
+        if (_mm256_testz_si256(fresh, fresh)) {
+            continue;
+        }
+        _mm256_store_si256((__m256i*)(visited + w), _mm256_or_si256(v, fresh));
+
+        uint64_t lanes[4];
+        _mm256_storeu_si256((__m256i*)lanes, fresh);
+        for (int k = 0; k < 4; k++) {
+            tail = appendBits(lanes[k], (w + k) * WORD_BITS, queue, tail);
+        }
+    }
+#endif
+    for (; w < words; w++) {
+        uint64_t fresh = row[w] & ~visited[w];
+        if (fresh != 0) {
+            visited[w] |= fresh;
+            tail = appendBits(fresh, w * WORD_BITS, queue, tail);
+        }
+    }
+    return tail;
+}
+
+// BFS traversal on the bit matrix; writes the visit order and returns the
+// number of vertices reached
+int bitBFS(BitGraph *g, int startVertex, int order[]) {
+    uint64_t *visited = allocWords(g->wordsPerRow);
+    int head = 0;
+    int tail = 0;
+
+    // The order array doubles as the queue
+    visited[startVertex / WORD_BITS] |= 1ULL << (startVertex % WORD_BITS);
+    order[tail++] = startVertex;
+
+    while (head < tail) {
+        int currentVertex = order[head++];
+        tail = expandRow(bitRow(g, currentVertex), visited, g->wordsPerRow, order, tail);
+    }
+
+    free(visited);
+    return tail;
+}
+
+// Check if graph is connected
+bool isConnected(BitGraph *g) {
+    int *order = (int*)malloc(sizeof(int) * g->numVertices);
+    if (order == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    int reached = bitBFS(g, 0, order);
+    free(order);
+    return reached == g->numVertices;
+}
+
+// ==================== INT MATRIX (BASELINE) ====================
+
+// Function to copy a bit graph into an int adjacency matrix
+IntGraph* createIntGraph(BitGraph *bg) {
+    IntGraph *g = (IntGraph*)malloc(sizeof(IntGraph));
+    size_t n = bg->numVertices;
+    if (g == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    g->numVertices = bg->numVertices;
+    g->adjMatrix = (int*)malloc(sizeof(int) * n * n);
+    if (g->adjMatrix == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            g->adjMatrix[i * n + j] = hasEdge(bg, i, j) ? 1 : 0;
+        }
+    }
+    return g;
+}
+
+void freeIntGraph(IntGraph *g) {
+    free(g->adjMatrix);
+    free(g);
+}
+
+// BFS traversal with Program 5's inner loop: one vertex test per step
+int intBFS(IntGraph *g, int startVertex, int order[]) {
+    bool *visited = (bool*)calloc(g->numVertices, sizeof(bool));
+    if (visited == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    size_t n = g->numVertices;
+    int head = 0;
+    int tail = 0;
+
+    visited[startVertex] = true;
+    order[tail++] = startVertex;
+
+    while (head < tail) {
+        int currentVertex = order[head++];
+        const int *row = g->adjMatrix + currentVertex * n;
+        for (size_t i = 0; i < n; i++) {
+            if (row[i] == 1 && !visited[i]) {
+                visited[i] = true;
+                order[tail++] = i;
+            }
+        }
+    }
+
+    free(visited);
+    return tail;
+}
+
+// ==================== BENCHMARK ====================
+
+// Function to generate a random undirected graph where each edge exists
+// with probability densityPercent / 100 (deterministic)
+BitGraph* randomDenseGraph(int vertices, int densityPercent, uint64_t seed) {
+    BitGraph *g = createBitGraph(vertices);
+    uint64_t state = seed;
+    uint64_t threshold = (uint64_t)densityPercent * (UINT64_MAX / 100);
+    for (int i = 0; i < vertices; i++) {
+        for (int j = i + 1; j < vertices; j++) {
+            if (nextRandom(&state) < threshold) {
+                addEdge(g, i, j);
+            }
+        }
+    }
+    return g;
+}
+
+void runBenchmark(int vertices, int densityPercent, int numRoots) {
+    BitGraph *bg = randomDenseGraph(vertices, densityPercent, 42 + vertices);
+    IntGraph *ig = createIntGraph(bg);
+
+    int *bitOrder = (int*)malloc(sizeof(int) * vertices);
+    int *intOrder = (int*)malloc(sizeof(int) * vertices);
+    if (bitOrder == NULL || intOrder == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    double intTime = 0;
+    double bitTime = 0;
+    bool same = true;
+    uint64_t state = 99;
+
+    for (int r = 0; r < numRoots; r++) {
+        int root = nextRandom(&state) % vertices;
+
+        double start = getTimeSeconds();
+        int intCount = intBFS(ig, root, intOrder);
+        intTime += getTimeSeconds() - start;
+
+        start = getTimeSeconds();
+        int bitCount = bitBFS(bg, root, bitOrder);
+        bitTime += getTimeSeconds() - start;
+
+        if (intCount != bitCount || memcmp(intOrder, bitOrder, sizeof(int) * intCount) != 0) {
+            same = false;
+        }
+    }
+
+    double intMB = (double)vertices * vertices * sizeof(int) / (1024 * 1024);
+    double bitMB = (double)vertices * bg->wordsPerRow * sizeof(uint64_t) / (1024 * 1024);
+
+    printf("%8d %10.1f %9.2f %12.3f %12.3f %8.1fx   %s\n",
+           vertices, intMB, bitMB,
+           intTime / numRoots * 1000, bitTime / numRoots * 1000,
+           intTime / bitTime, same ? "yes" : "NO");
+
+    free(bitOrder);
+    free(intOrder);
+    freeIntGraph(ig);
+    freeBitGraph(bg);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  GRAPH TRAVERSAL (BFS)\n");
+    printf("  Using Bit-Packed Adjacency Matrix\n");
+    printf("=========================================\n\n");
+
+    // Same example graph as Program 5
+    printf("Creating example graph with 6 vertices:\n\n");
+    BitGraph *g = createBitGraph(6);
+    addEdge(g, 0, 1);
+    addEdge(g, 0, 3);
+    addEdge(g, 1, 2);
+    addEdge(g, 1, 4);
+    addEdge(g, 2, 5);
+    addEdge(g, 3, 4);
+    addEdge(g, 4, 5);
+
+    printf("Graph Structure:\n");
+    printf("    0 --- 1 --- 2\n");
+    printf("    |     |     |\n");
+    printf("    3 --- 4 --- 5\n");
+
+    displayGraph(g);
+
+    int order[6];
+    int starts[] = {0, 2};
+    for (int s = 0; s < 2; s++) {
+        int count = bitBFS(g, starts[s], order);
+        printf("\nBFS Traversal starting from vertex %d:\n", starts[s]);
+        for (int i = 0; i < count; i++) {
+            printf("%d ", order[i]);
+        }
+        printf("\n");
+    }
+    printf("\nGraph is %s\n", isConnected(g) ? "connected" : "not connected");
+    freeBitGraph(g);
+
+    // Dense random graphs of growing size
+    int maxVertices = 16384;
+    int densityPercent = 25;
+    int numRoots = 4;
+    if (argc > 1) {
+        maxVertices = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        densityPercent = atoi(argv[2]);
+    }
+    if (maxVertices < 1 || densityPercent < 0 || densityPercent > 100) {
+        printf("Usage: %s [maxVertices] [densityPercent 0-100]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Dense Graph Benchmark (%d%% density, %d roots):\n", densityPercent, numRoots);
+    printf("-------------------------------------------\n");
+#ifdef __AVX2__
+    printf("Row expansion: AVX2, 256 bits per step\n\n");
+#else
+    printf("Row expansion: scalar, 64 bits per step (compile with -mavx2 for AVX2)\n\n");
+#endif
+    printf("%8s %10s %9s %12s %12s %9s   %s\n",
+           "Vertices", "Int MB", "Bit MB", "Int ms/BFS", "Bit ms/BFS", "Speedup", "Same order");
+    printf("-------------------------------------------------------------------------------\n");
+
+    for (int vertices = 1024; vertices <= maxVertices; vertices *= 2) {
+        runBenchmark(vertices, densityPercent, numRoots);
+    }
+    if (maxVertices < 1024) {
+        runBenchmark(maxVertices, densityPercent, numRoots);
+    }
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
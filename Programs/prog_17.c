@@ -0,0 +1,520 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_LEVELS 256
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// Statistics for one BFS level
+typedef struct {
+    bool bottomUp;
+    int frontierSize;
+    long long edgesExamined;
+    double seconds;
+} LevelStats;
+
+// Result of one BFS run
+typedef struct {
+    int reached;
+    int numLevels;
+    long long edgesExamined;
+    double seconds;
+    LevelStats levels[MAX_LEVELS];
+} BFSResult;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== CSR CONSTRUCTION ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to build an undirected CSR graph with sorted, duplicate-free
+// neighbor lists and no self loops
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        if (edges[e].src != edges[e].dest) {
+            offsets[edges[e].src + 1]++;
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u != v) {
+            neighbors[cursor[u]++] = v;
+            neighbors[cursor[v]++] = u;
+        }
+    }
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        qsort(neighbors + start, end - start, sizeof(int), compareInts);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+static inline long long degree(CSRGraph *g, int v) {
+    return g->rowOffsets[v + 1] - g->rowOffsets[v];
+}
+
+// Function to generate an R-MAT graph with 2^scale vertices: each edge picks
+// a quadrant of the adjacency matrix with probabilities a, b, c, d at every
+// level, which gives the skewed degrees and small diameter of social networks
+Edge* generateRMAT(int scale, long long numEdges, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seed;
+
+    for (long long e = 0; e < numEdges; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0);
+            if (r < a) {
+                // top-left: neither bit set
+            } else if (r < a + b) {
+                v |= 1 << bit;
+            } else if (r < a + b + c) {
+                u |= 1 << bit;
+            } else {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = u;
+        edges[e].dest = v;
+    }
+    return edges;
+}
+
+// ==================== BFS STEPS ====================
+
+// Top-down step: every frontier vertex scans its neighbors for unvisited ones.
+// Returns edges examined; *scoutCount gets the degree sum of the new frontier.
+long long topDownStep(CSRGraph *g, int *frontier, int frontierSize, int *next, int *nextSize,
+                      int *parent, int *depth, int level, long long *scoutCount) {
+    long long examined = 0;
+    long long scouts = 0;
+    int size = 0;
+
+    for (int f = 0; f < frontierSize; f++) {
+        int u = frontier[f];
+        for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+            int v = g->neighbors[i];
+            examined++;
+            if (parent[v] < 0) {
+                parent[v] = u;
+                depth[v] = level;
+                next[size++] = v;
+                scouts += degree(g, v);
+            }
+        }
+    }
+
+    *nextSize = size;
+    *scoutCount = scouts;
+    return examined;
+}
+
+// Bottom-up step: every unvisited vertex scans its neighbors for any parent
+// in the frontier bitmap and stops at the first one. Returns edges examined.
+long long bottomUpStep(CSRGraph *g, const uint64_t *frontierBits, uint64_t *nextBits,
+                       int *parent, int *depth, int level, int *nextSize) {
+    long long examined = 0;
+    int size = 0;
+    int words = (g->numVertices + 63) / 64;
+    memset(nextBits, 0, sizeof(uint64_t) * words);
+
+    for (int v = 0; v < g->numVertices; v++) {
+        if (parent[v] >= 0) {
+            continue;
+        }
+        for (long long i = g->rowOffsets[v]; i < g->rowOffsets[v + 1]; i++) {
+            int u = g->neighbors[i];
+            examined++;
+            if ((frontierBits[u >> 6] >> (u & 63)) & 1) {
+                parent[v] = u;
+                depth[v] = level;
+                nextBits[v >> 6] |= 1ULL << (v & 63);
+                size++;
+                break;
+            }
+        }
+    }
+
+    *nextSize = size;
+    return examined;
+}
+
+void queueToBitmap(const int *queue, int size, uint64_t *bits, int numVertices) {
+    memset(bits, 0, sizeof(uint64_t) * ((numVertices + 63) / 64));
+    for (int i = 0; i < size; i++) {
+        bits[queue[i] >> 6] |= 1ULL << (queue[i] & 63);
+    }
+}
+
+int bitmapToQueue(const uint64_t *bits, int numVertices, int *queue) {
+    int size = 0;
+    int words = (numVertices + 63) / 64;
+    for (int w = 0; w < words; w++) {
+        uint64_t word = bits[w];
+        while (word != 0) {
+            queue[size++] = w * 64 + __builtin_ctzll(word);
+            word &= word - 1;
+        }
+    }
+    return size;
+}
+
+// ==================== BFS DRIVERS ====================
+
+// Function to reset per-run arrays
+static void startBFS(CSRGraph *g, int root, int *parent, int *depth, BFSResult *result) {
+    for (int v = 0; v < g->numVertices; v++) {
+        parent[v] = -1;
+        depth[v] = -1;
+    }
+    parent[root] = root;
+    depth[root] = 0;
+    result->reached = 1;
+    result->numLevels = 0;
+    result->edgesExamined = 0;
+}
+
+static void recordLevel(BFSResult *result, bool bottomUp, int frontierSize,
+                        long long examined, double seconds) {
+    if (result->numLevels < MAX_LEVELS) {
+        LevelStats *s = &result->levels[result->numLevels];
+        s->bottomUp = bottomUp;
+        s->frontierSize = frontierSize;
+        s->edgesExamined = examined;
+        s->seconds = seconds;
+    }
+    result->numLevels++;
+    result->edgesExamined += examined;
+}
+
+// Plain level-synchronous top-down BFS (baseline)
+void topDownBFS(CSRGraph *g, int root, int *parent, int *depth, BFSResult *result) {
+    int *frontier = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    int *next = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    startBFS(g, root, parent, depth, result);
+
+    double start = getTimeSeconds();
+    int frontierSize = 1;
+    frontier[0] = root;
+    for (int level = 1; frontierSize > 0; level++) {
+        double levelStart = getTimeSeconds();
+        int nextSize;
+        long long scouts;
+        long long examined = topDownStep(g, frontier, frontierSize, next, &nextSize,
+                                         parent, depth, level, &scouts);
+        recordLevel(result, false, frontierSize, examined, getTimeSeconds() - levelStart);
+        result->reached += nextSize;
+
+        int *swap = frontier;
+        frontier = next;
+        next = swap;
+        frontierSize = nextSize;
+    }
+    result->seconds = getTimeSeconds() - start;
+
+    free(frontier);
+    free(next);
+}
+
+// Direction-optimizing BFS: switch to bottom-up when the edges out of the
+// frontier exceed (edges left to check) / alpha, and back to top-down when
+// the frontier shrinks below numVertices / beta
+void directionOptimizingBFS(CSRGraph *g, int root, double alpha, double beta,
+                            int *parent, int *depth, BFSResult *result) {
+    int n = g->numVertices;
+    int words = (n + 63) / 64;
+    int *frontier = (int*)allocOrExit(sizeof(int) * n);
+    int *next = (int*)allocOrExit(sizeof(int) * n);
+    uint64_t *frontierBits = (uint64_t*)allocOrExit(sizeof(uint64_t) * words);
+    uint64_t *nextBits = (uint64_t*)allocOrExit(sizeof(uint64_t) * words);
+    startBFS(g, root, parent, depth, result);
+
+    double start = getTimeSeconds();
+    long long edgesToCheck = g->numEdges - degree(g, root);
+    long long scoutCount = degree(g, root);
+    int frontierSize = 1;
+    frontier[0] = root;
+    int level = 1;
+
+    while (frontierSize > 0) {
+        double levelStart = getTimeSeconds();
+
+        if (scoutCount > edgesToCheck / alpha) {
+            // Bottom-up phase: keep going while the frontier is growing or still large
+            queueToBitmap(frontier, frontierSize, frontierBits, n);
+            int previousSize;
+            do {
+                previousSize = frontierSize;
+                long long examined = bottomUpStep(g, frontierBits, nextBits, parent, depth,
+                                                  level++, &frontierSize);
+                recordLevel(result, true, previousSize, examined, getTimeSeconds() - levelStart);
+                result->reached += frontierSize;
+                levelStart = getTimeSeconds();
+
+                uint64_t *swap = frontierBits;
+                frontierBits = nextBits;
+                nextBits = swap;
+            } while (frontierSize > 0 && (frontierSize >= previousSize || frontierSize > n / beta));
+
+            frontierSize = bitmapToQueue(frontierBits, n, frontier);
+            edgesToCheck = 0;
+            for (int v = 0; v < n; v++) {
+                if (parent[v] < 0) {
+                    edgesToCheck += degree(g, v);
+                }
+            }
+            scoutCount = 0;
+            for (int f = 0; f < frontierSize; f++) {
+                scoutCount += degree(g, frontier[f]);
+            }
+        } else {
+            int nextSize;
+            edgesToCheck -= scoutCount;
+            long long examined = topDownStep(g, frontier, frontierSize, next, &nextSize,
+                                             parent, depth, level++, &scoutCount);
+            recordLevel(result, false, frontierSize, examined, getTimeSeconds() - levelStart);
+            result->reached += nextSize;
+
+            int *swap = frontier;
+            frontier = next;
+            next = swap;
+            frontierSize = nextSize;
+        }
+    }
+    result->seconds = getTimeSeconds() - start;
+
+    free(frontier);
+    free(next);
+    free(frontierBits);
+    free(nextBits);
+}
+
+// Function to check that two runs reached the same vertices at the same depths
+// and that every parent is a real neighbor one level up
+bool validateBFS(CSRGraph *g, int root, const int *parent, const int *depth, const int *referenceDepth) {
+    for (int v = 0; v < g->numVertices; v++) {
+        if (depth[v] != referenceDepth[v]) {
+            return false;
+        }
+        if (depth[v] <= 0) {
+            continue;
+        }
+        int p = parent[v];
+        if (p < 0 || depth[p] != depth[v] - 1) {
+            return false;
+        }
+        bool found = false;
+        for (long long i = g->rowOffsets[v]; i < g->rowOffsets[v + 1]; i++) {
+            if (g->neighbors[i] == p) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return parent[root] == root;
+}
+
+void printLevels(const char *name, BFSResult *r) {
+    printf("\n%s: %d vertices reached, %lld edges examined, %.3f ms\n",
+           name, r->reached, r->edgesExamined, r->seconds * 1000);
+    printf("%6s %-10s %12s %16s %10s\n", "Level", "Direction", "Frontier", "Edges examined", "ms");
+    printf("----------------------------------------------------------\n");
+    int shown = r->numLevels < MAX_LEVELS ? r->numLevels : MAX_LEVELS;
+    for (int i = 0; i < shown; i++) {
+        LevelStats *s = &r->levels[i];
+        printf("%6d %-10s %12d %16lld %10.3f\n", i, s->bottomUp ? "bottom-up" : "top-down",
+               s->frontierSize, s->edgesExamined, s->seconds * 1000);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int scale = 20;
+    int edgeFactor = 16;
+    double alpha = 15.0;
+    double beta = 18.0;
+    int numRoots = 8;
+
+    if (argc > 1) {
+        scale = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        edgeFactor = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        alpha = atof(argv[3]);
+    }
+    if (argc > 4) {
+        beta = atof(argv[4]);
+    }
+    if (scale < 1 || scale > 28 || edgeFactor < 1 || alpha <= 0 || beta <= 0) {
+        printf("Usage: %s [scale 1-28] [edgeFactor] [alpha] [beta]\n", argv[0]);
+        return 1;
+    }
+
+    printf("=========================================\n");
+    printf("  DIRECTION-OPTIMIZING BFS\n");
+    printf("  Top-Down / Bottom-Up on a CSR Graph\n");
+    printf("=========================================\n\n");
+
+    int numVertices = 1 << scale;
+    long long numEdges = (long long)edgeFactor * numVertices;
+    printf("Generating R-MAT graph: scale %d (%d vertices), %lld edges...\n", scale, numVertices, numEdges);
+    Edge *edges = generateRMAT(scale, numEdges, 12345);
+    CSRGraph *g = buildCSR(numVertices, edges, numEdges);
+    free(edges);
+    printf("CSR graph: %lld adjacency entries after removing duplicates and self loops\n", g->numEdges);
+    if (g->numEdges == 0) {
+        printf("No non-isolated vertex to use as a BFS root\n");
+        freeCSR(g);
+        return 1;
+    }
+    printf("alpha = %.1f, beta = %.1f\n", alpha, beta);
+
+    int *parent = (int*)allocOrExit(sizeof(int) * numVertices);
+    int *depth = (int*)allocOrExit(sizeof(int) * numVertices);
+    int *referenceDepth = (int*)allocOrExit(sizeof(int) * numVertices);
+    BFSResult *topDown = (BFSResult*)allocOrExit(sizeof(BFSResult));
+    BFSResult *hybrid = (BFSResult*)allocOrExit(sizeof(BFSResult));
+
+    // Roots are vertices with at least one edge
+    uint64_t state = 2024;
+    int roots[64];
+    for (int r = 0; r < numRoots; r++) {
+        do {
+            roots[r] = nextRandom(&state) % numVertices;
+        } while (degree(g, roots[r]) == 0);
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Per-Level Breakdown (root %d):\n", roots[0]);
+    printf("-------------------------------------------");
+    topDownBFS(g, roots[0], parent, referenceDepth, topDown);
+    printLevels("Top-down BFS", topDown);
+    directionOptimizingBFS(g, roots[0], alpha, beta, parent, depth, hybrid);
+    printLevels("Direction-optimizing BFS", hybrid);
+
+    printf("\n-------------------------------------------\n");
+    printf("%d Roots:\n", numRoots);
+    printf("-------------------------------------------\n");
+    printf("%10s %10s %14s %14s %10s %10s %8s %7s\n", "Root", "Reached", "TD edges", "DO edges",
+           "TD ms", "DO ms", "Speedup", "Valid");
+    printf("-------------------------------------------------------------------------------------\n");
+
+    double totalTopDown = 0;
+    double totalHybrid = 0;
+    bool allValid = true;
+    for (int r = 0; r < numRoots; r++) {
+        topDownBFS(g, roots[r], parent, referenceDepth, topDown);
+        directionOptimizingBFS(g, roots[r], alpha, beta, parent, depth, hybrid);
+        bool valid = hybrid->reached == topDown->reached &&
+                     validateBFS(g, roots[r], parent, depth, referenceDepth);
+        allValid = allValid && valid;
+        totalTopDown += topDown->seconds;
+        totalHybrid += hybrid->seconds;
+
+        printf("%10d %10d %14lld %14lld %10.2f %10.2f %7.2fx %7s\n", roots[r], topDown->reached,
+               topDown->edgesExamined, hybrid->edgesExamined, topDown->seconds * 1000,
+               hybrid->seconds * 1000, topDown->seconds / hybrid->seconds, valid ? "yes" : "NO");
+    }
+    printf("\nTotal: top-down %.1f ms, direction-optimizing %.1f ms (%.2fx)\n",
+           totalTopDown * 1000, totalHybrid * 1000, totalTopDown / totalHybrid);
+    printf("All depths match top-down and all parents valid: %s\n", allValid ? "yes" : "NO");
+
+    free(parent);
+    free(depth);
+    free(referenceDepth);
+    free(topDown);
+    free(hybrid);
+    freeCSR(g);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
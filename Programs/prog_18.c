@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+
+#define MAX_THREADS 256
+#define CHUNK_SIZE 64          // Frontier vertices claimed per atomic fetch
+#define LOCAL_BUFFER_SIZE 1024 // Next-frontier entries buffered per thread
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// State shared by all BFS threads
+typedef struct {
+    CSRGraph *g;
+    _Atomic uint64_t *visited;  // One bit per vertex
+    int *parent;
+    int *depth;
+
+    int *frontier;
+    int frontierSize;
+    int *next;
+    atomic_int nextSize;       // Slots reserved in next
+    atomic_int frontierCursor; // Next unclaimed frontier index
+    int level;
+
+    pthread_barrier_t barrier;
+} ParallelBFS;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== GRAPH ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to build an undirected CSR graph with sorted, duplicate-free
+// neighbor lists and no self loops
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        if (edges[e].src != edges[e].dest) {
+            offsets[edges[e].src + 1]++;
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u != v) {
+            neighbors[cursor[u]++] = v;
+            neighbors[cursor[v]++] = u;
+        }
+    }
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        qsort(neighbors + start, end - start, sizeof(int), compareInts);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+// Function to generate an R-MAT graph with 2^scale vertices (see Program 17)
+Edge* generateRMAT(int scale, long long numEdges, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seed;
+
+    for (long long e = 0; e < numEdges; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0);
+            if (r >= a && r < a + b) {
+                v |= 1 << bit;
+            } else if (r >= a + b && r < a + b + c) {
+                u |= 1 << bit;
+            } else if (r >= a + b + c) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = u;
+        edges[e].dest = v;
+    }
+    return edges;
+}
+
+// ==================== SEQUENTIAL BFS (REFERENCE) ====================
+
+// Single-threaded queue BFS filling parent and depth; returns vertices reached
+int sequentialBFS(CSRGraph *g, int root, int *parent, int *depth) {
+    int *queue = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    for (int v = 0; v < g->numVertices; v++) {
+        parent[v] = -1;
+        depth[v] = -1;
+    }
+
+    int head = 0;
+    int tail = 0;
+    parent[root] = root;
+    depth[root] = 0;
+    queue[tail++] = root;
+
+    while (head < tail) {
+        int u = queue[head++];
+        for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+            int v = g->neighbors[i];
+            if (parent[v] < 0) {
+                parent[v] = u;
+                depth[v] = depth[u] + 1;
+                queue[tail++] = v;
+            }
+        }
+    }
+
+    free(queue);
+    return tail;
+}
+
+// ==================== PARALLEL BFS ====================
+
+// Function to claim a vertex: atomic test-and-set of its visited bit.
+// The plain load first avoids the atomic RMW for already-visited vertices.
+static inline bool claimVertex(_Atomic uint64_t *visited, int v) {
+    uint64_t mask = 1ULL << (v & 63);
+    if (atomic_load_explicit(&visited[v >> 6], memory_order_relaxed) & mask) {
+        return false;
+    }
+    uint64_t old = atomic_fetch_or_explicit(&visited[v >> 6], mask, memory_order_relaxed);
+    return (old & mask) == 0;
+}
+
+// Function to append a thread's local buffer to the shared next frontier
+static void flushLocal(ParallelBFS *bfs, int *local, int *count) {
+    if (*count == 0) {
+        return;
+    }
+    int pos = atomic_fetch_add_explicit(&bfs->nextSize, *count, memory_order_relaxed);
+    memcpy(bfs->next + pos, local, sizeof(int) * (*count));
+    *count = 0;
+}
+
+// Worker: processes frontier chunks for every level, synchronizing at barriers
+void* bfsWorker(void *arg) {
+    ParallelBFS *bfs = (ParallelBFS*)arg;
+    CSRGraph *g = bfs->g;
+    int local[LOCAL_BUFFER_SIZE];
+    int count = 0;
+
+    while (true) {
+        // Everyone sees the new frontier (or termination) after this barrier
+        pthread_barrier_wait(&bfs->barrier);
+        if (bfs->frontierSize == 0) {
+            break;
+        }
+        int level = bfs->level;
+
+        while (true) {
+            int begin = atomic_fetch_add_explicit(&bfs->frontierCursor, CHUNK_SIZE, memory_order_relaxed);
+            if (begin >= bfs->frontierSize) {
+                break;
+            }
+            int end = begin + CHUNK_SIZE < bfs->frontierSize ? begin + CHUNK_SIZE : bfs->frontierSize;
+
+            for (int f = begin; f < end; f++) {
+                int u = bfs->frontier[f];
+                for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+                    int v = g->neighbors[i];
+                    if (claimVertex(bfs->visited, v)) {
+                        // Only the claiming thread writes v's entries
+                        bfs->parent[v] = u;
+                        bfs->depth[v] = level;
+                        local[count++] = v;
+                        if (count == LOCAL_BUFFER_SIZE) {
+                            flushLocal(bfs, local, &count);
+                        }
+                    }
+                }
+            }
+        }
+        flushLocal(bfs, local, &count);
+
+        // Level done; one thread swaps frontiers while the others wait
+        if (pthread_barrier_wait(&bfs->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+            int *swap = bfs->frontier;
+            bfs->frontier = bfs->next;
+            bfs->next = swap;
+            bfs->frontierSize = atomic_load(&bfs->nextSize);
+            atomic_store(&bfs->nextSize, 0);
+            atomic_store(&bfs->frontierCursor, 0);
+            bfs->level++;
+        }
+    }
+    return NULL;
+}
+
+// Level-synchronous parallel BFS; fills parent and depth (-1 if unreached)
+// and returns the number of levels
+int parallelBFS(CSRGraph *g, int root, int numThreads, int *parent, int *depth) {
+    int n = g->numVertices;
+    int words = (n + 63) / 64;
+    ParallelBFS bfs;
+    bfs.g = g;
+    bfs.visited = (_Atomic uint64_t*)allocOrExit(sizeof(uint64_t) * words);
+    bfs.parent = parent;
+    bfs.depth = depth;
+    bfs.frontier = (int*)allocOrExit(sizeof(int) * n);
+    bfs.next = (int*)allocOrExit(sizeof(int) * n);
+
+    for (int w = 0; w < words; w++) {
+        atomic_init(&bfs.visited[w], 0);
+    }
+    for (int v = 0; v < n; v++) {
+        parent[v] = -1;
+        depth[v] = -1;
+    }
+
+    atomic_store(&bfs.visited[root >> 6], 1ULL << (root & 63));
+    parent[root] = root;
+    depth[root] = 0;
+    bfs.frontier[0] = root;
+    bfs.frontierSize = 1;
+    bfs.level = 1;
+    atomic_init(&bfs.nextSize, 0);
+    atomic_init(&bfs.frontierCursor, 0);
+    pthread_barrier_init(&bfs.barrier, NULL, numThreads);
+
+    pthread_t threads[MAX_THREADS];
+    for (int t = 1; t < numThreads; t++) {
+        if (pthread_create(&threads[t], NULL, bfsWorker, &bfs) != 0) {
+            printf("Thread creation failed!\n");
+            exit(1);
+        }
+    }
+    // The calling thread is worker 0
+    bfsWorker(&bfs);
+
+    for (int t = 1; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    pthread_barrier_destroy(&bfs.barrier);
+    free((void*)bfs.visited);
+    free(bfs.frontier);
+    free(bfs.next);
+    return bfs.level - 1;
+}
+
+// Function to check depths against the sequential BFS and that every parent
+// is a neighbor one level closer to the root
+bool validateBFS(CSRGraph *g, int root, const int *parent, const int *depth, const int *referenceDepth) {
+    if (parent[root] != root || depth[root] != 0) {
+        return false;
+    }
+    for (int v = 0; v < g->numVertices; v++) {
+        if (depth[v] != referenceDepth[v]) {
+            return false;
+        }
+        if (v == root || depth[v] < 0) {
+            continue;
+        }
+        int p = parent[v];
+        if (p < 0 || depth[p] != depth[v] - 1) {
+            return false;
+        }
+        // Neighbor lists are sorted, so look the parent up by binary search
+        long long lo = g->rowOffsets[v];
+        long long hi = g->rowOffsets[v + 1] - 1;
+        bool found = false;
+        while (lo <= hi) {
+            long long mid = lo + (hi - lo) / 2;
+            if (g->neighbors[mid] == p) {
+                found = true;
+                break;
+            } else if (g->neighbors[mid] < p) {
+                lo = mid + 1;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int scale = 20;
+    int edgeFactor = 16;
+    int maxThreads = 16;
+    int numRoots = 4;
+
+    if (argc > 1) {
+        scale = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        edgeFactor = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        maxThreads = atoi(argv[3]);
+    }
+    if (scale < 1 || scale > 28 || edgeFactor < 1 || maxThreads < 1 || maxThreads > MAX_THREADS) {
+        printf("Usage: %s [scale 1-28] [edgeFactor] [maxThreads 1-%d]\n", argv[0], MAX_THREADS);
+        return 1;
+    }
+
+    printf("=========================================\n");
+    printf("  PARALLEL LEVEL-SYNCHRONOUS BFS\n");
+    printf("  Atomic Visited Bitmap + Thread Buffers\n");
+    printf("=========================================\n\n");
+
+    int numVertices = 1 << scale;
+    long long numEdges = (long long)edgeFactor * numVertices;
+    printf("Generating R-MAT graph: scale %d (%d vertices), %lld edges...\n", scale, numVertices, numEdges);
+    Edge *edges = generateRMAT(scale, numEdges, 12345);
+    CSRGraph *g = buildCSR(numVertices, edges, numEdges);
+    free(edges);
+    printf("CSR graph: %lld adjacency entries\n", g->numEdges);
+    if (g->numEdges == 0) {
+        printf("No non-isolated vertex to use as a BFS root\n");
+        freeCSR(g);
+        return 1;
+    }
+    printf("Online CPUs: %ld\n", sysconf(_SC_NPROCESSORS_ONLN));
+
+    int *parent = (int*)allocOrExit(sizeof(int) * numVertices);
+    int *depth = (int*)allocOrExit(sizeof(int) * numVertices);
+    int *referenceParent = (int*)allocOrExit(sizeof(int) * numVertices);
+    int *referenceDepth = (int*)allocOrExit(sizeof(int) * numVertices);
+
+    // Roots are vertices with at least one edge
+    int roots[16];
+    uint64_t state = 2024;
+    for (int r = 0; r < numRoots; r++) {
+        do {
+            roots[r] = nextRandom(&state) % numVertices;
+        } while (g->rowOffsets[roots[r] + 1] == g->rowOffsets[roots[r]]);
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Sequential Reference:\n");
+    printf("-------------------------------------------\n");
+    double sequentialTime = 0;
+    long long reachedEdges = 0;
+    for (int r = 0; r < numRoots; r++) {
+        double start = getTimeSeconds();
+        int reached = sequentialBFS(g, roots[r], referenceParent, referenceDepth);
+        sequentialTime += getTimeSeconds() - start;
+        for (int v = 0; v < numVertices; v++) {
+            if (referenceDepth[v] >= 0) {
+                reachedEdges += g->rowOffsets[v + 1] - g->rowOffsets[v];
+            }
+        }
+        printf("Root %7d: %d vertices reached\n", roots[r], reached);
+    }
+    printf("Sequential BFS: %.2f ms per root, %.1f M edges/s\n",
+           sequentialTime / numRoots * 1000, reachedEdges / sequentialTime / 1e6);
+
+    printf("\n-------------------------------------------\n");
+    printf("Thread Sweep (%d roots each):\n", numRoots);
+    printf("-------------------------------------------\n");
+    printf("%8s %12s %12s %10s %10s %8s\n", "Threads", "ms/BFS", "M edges/s", "vs seq", "Scaling", "Valid");
+    printf("----------------------------------------------------------------\n");
+
+    double oneThreadTime = 0;
+    bool allValid = true;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double total = 0;
+        bool valid = true;
+        for (int r = 0; r < numRoots; r++) {
+            sequentialBFS(g, roots[r], referenceParent, referenceDepth);
+            double start = getTimeSeconds();
+            parallelBFS(g, roots[r], threads, parent, depth);
+            total += getTimeSeconds() - start;
+            valid = valid && validateBFS(g, roots[r], parent, depth, referenceDepth);
+        }
+        if (threads == 1) {
+            oneThreadTime = total;
+        }
+        allValid = allValid && valid;
+        printf("%8d %12.2f %12.1f %9.2fx %9.2fx %8s\n", threads, total / numRoots * 1000,
+               reachedEdges / total / 1e6, sequentialTime / total, oneThreadTime / total,
+               valid ? "yes" : "NO");
+    }
+
+    printf("\nAll parallel runs match sequential depths with valid parents: %s\n", allValid ? "yes" : "NO");
+
+    free(parent);
+    free(depth);
+    free(referenceParent);
+    free(referenceDepth);
+    freeCSR(g);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,575 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define WHITE 0   // Not discovered
+#define GRAY 1    // Discovered, still on the stack
+#define BLACK 2   // Finished
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    bool directed;
+    long long numEdges;       // Adjacency entries
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// DFS stack frame: a vertex and the index of the next neighbor to try
+typedef struct {
+    int vertex;
+    long long cursor;
+} DFSFrame;
+
+// DFS results and working memory, all O(V)
+typedef struct {
+    int numVertices;
+    unsigned char *color;
+    int *discovery;      // Time the vertex was first reached
+    int *finish;         // Time all its descendants were done
+    int *order;          // Vertices in discovery order (preorder)
+    int *postOrder;      // Vertices in finish order
+    int orderCount;
+    int postCount;
+    int time;
+    DFSFrame *stack;
+    int maxDepth;
+    int *cycle;          // First directed cycle found, if any
+    int cycleLength;
+} DFSState;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== GRAPH ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to build a CSR graph with sorted, duplicate-free neighbor lists
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges, bool directed) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        offsets[edges[e].src + 1]++;
+        if (!directed && edges[e].src != edges[e].dest) {
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        neighbors[cursor[u]++] = v;
+        if (!directed && u != v) {
+            neighbors[cursor[v]++] = u;
+        }
+    }
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        qsort(neighbors + start, end - start, sizeof(int), compareInts);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->directed = directed;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+// ==================== DFS STATE ====================
+
+DFSState* createDFSState(int numVertices) {
+    DFSState *s = (DFSState*)allocOrExit(sizeof(DFSState));
+    s->numVertices = numVertices;
+    s->color = (unsigned char*)allocOrExit(numVertices);
+    s->discovery = (int*)allocOrExit(sizeof(int) * numVertices);
+    s->finish = (int*)allocOrExit(sizeof(int) * numVertices);
+    s->order = (int*)allocOrExit(sizeof(int) * numVertices);
+    s->postOrder = (int*)allocOrExit(sizeof(int) * numVertices);
+    s->stack = (DFSFrame*)allocOrExit(sizeof(DFSFrame) * numVertices);
+    s->cycle = (int*)allocOrExit(sizeof(int) * numVertices);
+    return s;
+}
+
+// Function to clear all vertices to WHITE and reset the clock
+void resetDFSState(DFSState *s) {
+    memset(s->color, WHITE, s->numVertices);
+    for (int v = 0; v < s->numVertices; v++) {
+        s->discovery[v] = -1;
+        s->finish[v] = -1;
+    }
+    s->orderCount = 0;
+    s->postCount = 0;
+    s->time = 0;
+    s->maxDepth = 0;
+    s->cycleLength = 0;
+}
+
+void freeDFSState(DFSState *s) {
+    free(s->color);
+    free(s->discovery);
+    free(s->finish);
+    free(s->order);
+    free(s->postOrder);
+    free(s->stack);
+    free(s->cycle);
+    free(s);
+}
+
+static inline void discoverVertex(DFSState *s, int v) {
+    s->color[v] = GRAY;
+    s->discovery[v] = s->time++;
+    s->order[s->orderCount++] = v;
+}
+
+static inline void finishVertex(DFSState *s, int v) {
+    s->color[v] = BLACK;
+    s->finish[v] = s->time++;
+    s->postOrder[s->postCount++] = v;
+}
+
+// ==================== ITERATIVE DFS ====================
+
+// Function to record the cycle closed by back edge (top of stack -> v):
+// the GRAY vertices on the stack from v up to the top
+static void recordCycle(DFSState *s, int top, int v) {
+    int from = top - 1;
+    while (s->stack[from].vertex != v) {
+        from--;
+    }
+    s->cycleLength = 0;
+    for (int i = from; i < top; i++) {
+        s->cycle[s->cycleLength++] = s->stack[i].vertex;
+    }
+}
+
+// DFS from one vertex with an explicit stack of (vertex, cursor) frames.
+// A frame is pushed once per vertex, so the stack never exceeds V frames, and
+// neighbors are tried in list order, which gives the recursive visit order.
+void DFSIterative(CSRGraph *g, DFSState *s, int startVertex) {
+    if (s->color[startVertex] != WHITE) {
+        return;
+    }
+    int top = 0;
+    discoverVertex(s, startVertex);
+    s->stack[top].vertex = startVertex;
+    s->stack[top].cursor = g->rowOffsets[startVertex];
+    top++;
+    if (top > s->maxDepth) {
+        s->maxDepth = top;
+    }
+
+    while (top > 0) {
+        DFSFrame *frame = &s->stack[top - 1];
+        int u = frame->vertex;
+
+        if (frame->cursor < g->rowOffsets[u + 1]) {
+            int v = g->neighbors[frame->cursor++];
+            if (s->color[v] == WHITE) {
+                // Equivalent of the recursive call: push and continue from v
+                discoverVertex(s, v);
+                s->stack[top].vertex = v;
+                s->stack[top].cursor = g->rowOffsets[v];
+                top++;
+                if (top > s->maxDepth) {
+                    s->maxDepth = top;
+                }
+            } else if (s->color[v] == GRAY && g->directed && s->cycleLength == 0) {
+                // Back edge in a directed graph: v is an ancestor of u
+                recordCycle(s, top, v);
+            }
+        } else {
+            // All neighbors done: equivalent of returning from the call
+            finishVertex(s, u);
+            top--;
+        }
+    }
+}
+
+// Function to run DFS from every undiscovered vertex (DFS forest)
+void DFSAll(CSRGraph *g, DFSState *s) {
+    resetDFSState(s);
+    for (int v = 0; v < g->numVertices; v++) {
+        if (s->color[v] == WHITE) {
+            DFSIterative(g, s, v);
+        }
+    }
+}
+
+// Function to produce a topological order (reverse finish order).
+// Returns false if the graph has a directed cycle, which is left in s->cycle.
+bool topologicalSort(CSRGraph *g, DFSState *s, int *topoOrder) {
+    DFSAll(g, s);
+    if (s->cycleLength > 0) {
+        return false;
+    }
+    for (int i = 0; i < s->postCount; i++) {
+        topoOrder[i] = s->postOrder[s->postCount - 1 - i];
+    }
+    return true;
+}
+
+// Function to check that every edge goes forward in the given order
+bool verifyTopologicalOrder(CSRGraph *g, const int *topoOrder) {
+    int *position = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    for (int i = 0; i < g->numVertices; i++) {
+        position[topoOrder[i]] = i;
+    }
+    bool ok = true;
+    for (int u = 0; u < g->numVertices && ok; u++) {
+        for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+            if (position[u] >= position[g->neighbors[i]]) {
+                ok = false;
+                break;
+            }
+        }
+    }
+    free(position);
+    return ok;
+}
+
+// ==================== REFERENCES ====================
+
+// DFS traversal (recursive), as in Program 5, with the same timestamps
+void DFSRecursive(CSRGraph *g, DFSState *s, int vertex) {
+    discoverVertex(s, vertex);
+    for (long long i = g->rowOffsets[vertex]; i < g->rowOffsets[vertex + 1]; i++) {
+        if (s->color[g->neighbors[i]] == WHITE) {
+            DFSRecursive(g, s, g->neighbors[i]);
+        }
+    }
+    finishVertex(s, vertex);
+}
+
+// Function to measure the largest stack Program 5's DFSIterative would need:
+// it pushes every unvisited neighbor each time a vertex is popped (small
+// graphs only: the stack is sized generously rather than exactly)
+long long edgeStackPeak(CSRGraph *g, int startVertex) {
+    bool *visited = (bool*)calloc(g->numVertices, sizeof(bool));
+    int *stack = (int*)allocOrExit(sizeof(int) * (g->numEdges * (long long)g->numVertices + 1));
+    if (visited == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    long long top = 0;
+    long long peak = 1;
+    stack[top++] = startVertex;
+
+    while (top > 0) {
+        int u = stack[--top];
+        visited[u] = true;
+        for (long long i = g->rowOffsets[u + 1] - 1; i >= g->rowOffsets[u]; i--) {
+            if (!visited[g->neighbors[i]]) {
+                stack[top++] = g->neighbors[i];
+            }
+        }
+        if (top > peak) {
+            peak = top;
+        }
+    }
+
+    free(visited);
+    free(stack);
+    return peak;
+}
+
+void printDFS(const char *name, DFSState *s, int startVertex) {
+    printf("\n%s starting from vertex %d:\n", name, startVertex);
+    for (int i = 0; i < s->orderCount; i++) {
+        printf("%d ", s->order[i]);
+    }
+    printf("\n  vertex:   ");
+    for (int v = 0; v < s->numVertices; v++) {
+        printf("%3d", v);
+    }
+    printf("\n  discovery:");
+    for (int v = 0; v < s->numVertices; v++) {
+        printf("%3d", s->discovery[v]);
+    }
+    printf("\n  finish:   ");
+    for (int v = 0; v < s->numVertices; v++) {
+        printf("%3d", s->finish[v]);
+    }
+    printf("\n");
+}
+
+bool sameDFS(DFSState *a, DFSState *b) {
+    size_t bytes = sizeof(int) * a->numVertices;
+    return a->orderCount == b->orderCount &&
+           memcmp(a->order, b->order, sizeof(int) * a->orderCount) == 0 &&
+           memcmp(a->discovery, b->discovery, bytes) == 0 &&
+           memcmp(a->finish, b->finish, bytes) == 0;
+}
+
+// ==================== LARGE GRAPHS ====================
+
+// Function to generate a random DAG: a hidden random ranking of the vertices,
+// and every edge goes from a rank to one of the next 64 ranks, so DFS paths
+// are long
+Edge* randomDAGEdges(int numVertices, long long numEdges, uint64_t seed) {
+    int *rank = (int*)allocOrExit(sizeof(int) * numVertices);
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * (numEdges + 1));
+    uint64_t state = seed;
+
+    for (int v = 0; v < numVertices; v++) {
+        rank[v] = v;
+    }
+    for (int v = numVertices - 1; v > 0; v--) {
+        int j = nextRandom(&state) % (v + 1);
+        int t = rank[v];
+        rank[v] = rank[j];
+        rank[j] = t;
+    }
+
+    // A chain through all ranks makes the DFS very deep
+    long long e = 0;
+    for (int i = 0; i + 1 < numVertices && e < numEdges; i++, e++) {
+        edges[e].src = rank[i];
+        edges[e].dest = rank[i + 1];
+    }
+    for (; e < numEdges; e++) {
+        int a = nextRandom(&state) % (numVertices - 1);
+        int b = a + 1 + nextRandom(&state) % 64;
+        if (b >= numVertices) {
+            b = numVertices - 1;
+        }
+        edges[e].src = rank[a];
+        edges[e].dest = rank[b];
+    }
+
+    free(rank);
+    return edges;
+}
+
+void runLargeGraphs(int numVertices, long long numEdges) {
+    // A path is the worst case for recursion: depth equals the vertex count
+    Edge *pathEdges = (Edge*)allocOrExit(sizeof(Edge) * (numVertices - 1));
+    for (int v = 0; v + 1 < numVertices; v++) {
+        pathEdges[v].src = v;
+        pathEdges[v].dest = v + 1;
+    }
+    CSRGraph *path = buildCSR(numVertices, pathEdges, numVertices - 1, false);
+    free(pathEdges);
+    DFSState *pathState = createDFSState(numVertices);
+    resetDFSState(pathState);
+    double pathStart = getTimeSeconds();
+    DFSIterative(path, pathState, 0);
+    printf("\nPath graph: %d vertices visited in %.3f s, max depth %d frames (%.1f MB heap stack)\n",
+           pathState->orderCount, getTimeSeconds() - pathStart, pathState->maxDepth,
+           pathState->maxDepth * sizeof(DFSFrame) / (1024.0 * 1024));
+    freeDFSState(pathState);
+    freeCSR(path);
+
+    printf("\nRandom DAG: %d vertices, %lld edges (includes a Hamiltonian chain)\n", numVertices, numEdges);
+    Edge *edges = randomDAGEdges(numVertices, numEdges, 77);
+    CSRGraph *g = buildCSR(numVertices, edges, numEdges, true);
+    DFSState *s = createDFSState(numVertices);
+    int *topoOrder = (int*)allocOrExit(sizeof(int) * numVertices);
+
+    double start = getTimeSeconds();
+    bool acyclic = topologicalSort(g, s, topoOrder);
+    double t = getTimeSeconds() - start;
+    printf("Topological sort: %s in %.3f s, max DFS depth %d frames (%.1f MB stack)\n",
+           acyclic ? "acyclic" : "CYCLE", t, s->maxDepth, s->maxDepth * sizeof(DFSFrame) / (1024.0 * 1024));
+    printf("Every edge goes forward in the order: %s\n",
+           acyclic && verifyTopologicalOrder(g, topoOrder) ? "yes" : "NO");
+    printf("A recursive DFS would need %d nested calls here\n", s->maxDepth);
+
+    // Add one edge from the last vertex in topological order back to the first
+    edges[numEdges].src = topoOrder[numVertices - 1];
+    edges[numEdges].dest = topoOrder[0];
+    freeCSR(g);
+    g = buildCSR(numVertices, edges, numEdges + 1, true);
+
+    start = getTimeSeconds();
+    acyclic = topologicalSort(g, s, topoOrder);
+    t = getTimeSeconds() - start;
+    printf("\nAfter adding edge %d -> %d:\n", edges[numEdges].src, edges[numEdges].dest);
+    if (acyclic) {
+        printf("No cycle found (unexpected)\n");
+    } else {
+        printf("Cycle detected in %.3f s: %d vertices, %d -> %d -> ... -> %d -> %d\n", t,
+               s->cycleLength, s->cycle[0], s->cycle[1], s->cycle[s->cycleLength - 1], s->cycle[0]);
+    }
+
+    free(topoOrder);
+    free(edges);
+    freeDFSState(s);
+    freeCSR(g);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  ITERATIVE DFS WITH TIMESTAMPS\n");
+    printf("  Explicit (vertex, cursor) Stack\n");
+    printf("=========================================\n\n");
+
+    // Same example graph as Program 5
+    printf("Creating example graph with 6 vertices:\n\n");
+    printf("Graph Structure:\n");
+    printf("    0 --- 1 --- 2\n");
+    printf("    |     |     |\n");
+    printf("    3 --- 4 --- 5\n");
+
+    Edge demoEdges[] = {{0, 1}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {4, 5}};
+    CSRGraph *g = buildCSR(6, demoEdges, 7, false);
+    DFSState *iterative = createDFSState(6);
+    DFSState *recursive = createDFSState(6);
+
+    int starts[] = {0, 2};
+    for (int i = 0; i < 2; i++) {
+        resetDFSState(recursive);
+        DFSRecursive(g, recursive, starts[i]);
+        printDFS("DFS Traversal (Recursive)", recursive, starts[i]);
+
+        resetDFSState(iterative);
+        DFSIterative(g, iterative, starts[i]);
+        printDFS("DFS Traversal (Iterative)", iterative, starts[i]);
+        printf("  identical order and timestamps: %s\n", sameDFS(iterative, recursive) ? "yes" : "NO");
+    }
+    freeDFSState(iterative);
+    freeDFSState(recursive);
+    freeCSR(g);
+
+    // Stack use on a complete graph with Program 5's MAX_VERTICES vertices
+    printf("\n-------------------------------------------\n");
+    printf("Stack Size on a Complete Graph (20 vertices):\n");
+    printf("-------------------------------------------\n");
+    Edge completeEdges[190];
+    int count = 0;
+    for (int u = 0; u < 20; u++) {
+        for (int v = u + 1; v < 20; v++) {
+            completeEdges[count].src = u;
+            completeEdges[count].dest = v;
+            count++;
+        }
+    }
+    g = buildCSR(20, completeEdges, count, false);
+    iterative = createDFSState(20);
+    resetDFSState(iterative);
+    DFSIterative(g, iterative, 0);
+    printf("Push-per-edge stack (Program 5) peak: %lld entries (its Stack holds 20)\n", edgeStackPeak(g, 0));
+    printf("Frame stack peak: %d frames\n", iterative->maxDepth);
+    freeDFSState(iterative);
+    freeCSR(g);
+
+    // Recursive vs iterative on a random directed graph
+    printf("\n-------------------------------------------\n");
+    printf("Recursive vs Iterative (random directed graph):\n");
+    printf("-------------------------------------------\n");
+    {
+        int n = 20000;
+        long long m = 100000;
+        Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * m);
+        uint64_t state = 5;
+        for (long long e = 0; e < m; e++) {
+            edges[e].src = nextRandom(&state) % n;
+            edges[e].dest = nextRandom(&state) % n;
+        }
+        g = buildCSR(n, edges, m, true);
+        free(edges);
+        iterative = createDFSState(n);
+        recursive = createDFSState(n);
+
+        DFSAll(g, iterative);
+        resetDFSState(recursive);
+        for (int v = 0; v < n; v++) {
+            if (recursive->color[v] == WHITE) {
+                DFSRecursive(g, recursive, v);
+            }
+        }
+        printf("%d vertices, %lld edges: identical discovery order and timestamps: %s\n",
+               n, g->numEdges, sameDFS(iterative, recursive) ? "yes" : "NO");
+        printf("Max depth %d frames; directed cycle found: %s (%d vertices)\n",
+               iterative->maxDepth, iterative->cycleLength > 0 ? "yes" : "no", iterative->cycleLength);
+        freeDFSState(iterative);
+        freeDFSState(recursive);
+        freeCSR(g);
+    }
+
+    // Million-vertex DAG
+    int numVertices = 2000000;
+    long long numEdges = 8000000;
+    if (argc > 1) {
+        numVertices = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        numEdges = atoll(argv[2]);
+    }
+    if (numVertices < 2 || numEdges < numVertices - 1) {
+        printf("Usage: %s [numVertices >= 2] [numEdges >= numVertices - 1]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Deep Graphs, Topological Sort and Cycles:\n");
+    printf("-------------------------------------------");
+    runLargeGraphs(numVertices, numEdges);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
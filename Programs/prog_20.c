@@ -0,0 +1,601 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+
+#define MAX_THREADS 256
+#define NEIGHBOR_ROUNDS 2     // Afforest: neighbors linked before sampling
+#define NUM_SAMPLES 1024      // Afforest: vertices sampled to find the giant component
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// Connected components of a graph
+typedef struct {
+    int numVertices;
+    int numComponents;
+    int *componentId;     // Dense id 0 .. numComponents - 1 for every vertex
+    int *componentSize;   // Vertices per component
+    int largest;          // Id of the largest component
+} Components;
+
+// State shared by the union-find threads
+typedef struct {
+    CSRGraph *g;
+    atomic_int *comp;     // Parent pointers; a root has comp[v] == v
+    int round;            // Neighbor round for linkNeighborRound
+    int skipComponent;    // Component skipped by linkRemaining
+} CCShared;
+
+typedef void (*PhaseFunction)(CCShared *shared, int begin, int end);
+
+// Arguments of one thread in one phase
+typedef struct {
+    CCShared *shared;
+    PhaseFunction phase;
+    int begin;
+    int end;
+} PhaseArgs;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== GRAPH ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to build an undirected CSR graph with sorted, duplicate-free
+// neighbor lists and no self loops
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        if (edges[e].src != edges[e].dest) {
+            offsets[edges[e].src + 1]++;
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u != v) {
+            neighbors[cursor[u]++] = v;
+            neighbors[cursor[v]++] = u;
+        }
+    }
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        qsort(neighbors + start, end - start, sizeof(int), compareInts);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+// Function to generate numEdges uniformly random edges (deterministic)
+Edge* randomEdges(int numVertices, long long numEdges, uint64_t seed) {
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seed;
+    for (long long e = 0; e < numEdges; e++) {
+        uint64_t r = nextRandom(&state);
+        edges[e].src = (int)((r & 0xFFFFFFFFu) % (uint64_t)numVertices);
+        edges[e].dest = (int)((r >> 32) % (uint64_t)numVertices);
+    }
+    return edges;
+}
+
+// Function to generate an R-MAT graph with 2^scale vertices (see Program 17)
+Edge* generateRMAT(int scale, long long numEdges, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seed;
+
+    for (long long e = 0; e < numEdges; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0);
+            if (r >= a && r < a + b) {
+                v |= 1 << bit;
+            } else if (r >= a + b && r < a + b + c) {
+                u |= 1 << bit;
+            } else if (r >= a + b + c) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = u;
+        edges[e].dest = v;
+    }
+    return edges;
+}
+
+// ==================== COMPONENTS RESULT ====================
+
+// Function to turn root labels (any vertex id per component) into dense ids
+// and count component sizes
+Components* buildComponents(const int *rootLabel, int numVertices) {
+    Components *c = (Components*)allocOrExit(sizeof(Components));
+    int *denseOf = (int*)allocOrExit(sizeof(int) * numVertices);
+    c->numVertices = numVertices;
+    c->componentId = (int*)allocOrExit(sizeof(int) * numVertices);
+    c->numComponents = 0;
+
+    for (int v = 0; v < numVertices; v++) {
+        denseOf[v] = -1;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        int root = rootLabel[v];
+        if (denseOf[root] < 0) {
+            denseOf[root] = c->numComponents++;
+        }
+        c->componentId[v] = denseOf[root];
+    }
+
+    c->componentSize = (int*)calloc(c->numComponents, sizeof(int));
+    if (c->componentSize == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    c->largest = 0;
+    for (int v = 0; v < numVertices; v++) {
+        c->componentSize[c->componentId[v]]++;
+    }
+    for (int id = 1; id < c->numComponents; id++) {
+        if (c->componentSize[id] > c->componentSize[c->largest]) {
+            c->largest = id;
+        }
+    }
+
+    free(denseOf);
+    return c;
+}
+
+void freeComponents(Components *c) {
+    free(c->componentId);
+    free(c->componentSize);
+    free(c);
+}
+
+// Check if graph is connected: O(1) on the result
+bool isConnected(Components *c) {
+    return c->numComponents <= 1;
+}
+
+// Check if two vertices are in the same component: O(1)
+bool sameComponent(Components *c, int u, int v) {
+    return c->componentId[u] == c->componentId[v];
+}
+
+// Function to check that two labelings describe the same partition
+bool samePartition(Components *a, Components *b) {
+    if (a->numComponents != b->numComponents) {
+        return false;
+    }
+    int *map = (int*)allocOrExit(sizeof(int) * a->numComponents);
+    bool same = true;
+    for (int id = 0; id < a->numComponents; id++) {
+        map[id] = -1;
+    }
+    for (int v = 0; v < a->numVertices && same; v++) {
+        int x = a->componentId[v];
+        int y = b->componentId[v];
+        if (map[x] < 0) {
+            map[x] = y;
+        } else if (map[x] != y) {
+            same = false;
+        }
+    }
+    free(map);
+    return same;
+}
+
+// ==================== SEQUENTIAL DFS LABELING ====================
+
+// Function to label components with an iterative DFS from every unvisited
+// vertex (Program 5's isConnected, repeated until every vertex is labeled)
+Components* componentsDFS(CSRGraph *g) {
+    int n = g->numVertices;
+    int *label = (int*)allocOrExit(sizeof(int) * n);
+    int *stack = (int*)allocOrExit(sizeof(int) * n);
+    for (int v = 0; v < n; v++) {
+        label[v] = -1;
+    }
+
+    for (int s = 0; s < n; s++) {
+        if (label[s] >= 0) {
+            continue;
+        }
+        // Mark on push, so each vertex enters the stack once
+        int top = 0;
+        label[s] = s;
+        stack[top++] = s;
+        while (top > 0) {
+            int u = stack[--top];
+            for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+                int v = g->neighbors[i];
+                if (label[v] < 0) {
+                    label[v] = s;
+                    stack[top++] = v;
+                }
+            }
+        }
+    }
+
+    Components *c = buildComponents(label, n);
+    free(label);
+    free(stack);
+    return c;
+}
+
+// ==================== PARALLEL UNION-FIND ====================
+
+// Function to hook the trees of u and v together without locks: the higher
+// root is pointed at the lower one with a CAS, retrying if another thread
+// changed that root first
+static inline void linkVertices(atomic_int *comp, int u, int v) {
+    int p1 = atomic_load_explicit(&comp[u], memory_order_relaxed);
+    int p2 = atomic_load_explicit(&comp[v], memory_order_relaxed);
+    while (p1 != p2) {
+        int high = p1 > p2 ? p1 : p2;
+        int low = p1 + p2 - high;
+        int pHigh = atomic_load_explicit(&comp[high], memory_order_relaxed);
+
+        if (pHigh == low) {
+            break;  // Already hooked
+        }
+        if (pHigh == high) {
+            int expected = high;
+            if (atomic_compare_exchange_strong_explicit(&comp[high], &expected, low,
+                                                        memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        }
+        // high was not a root (or lost the race): climb one level and retry
+        p1 = atomic_load_explicit(&comp[atomic_load_explicit(&comp[high], memory_order_relaxed)],
+                                  memory_order_relaxed);
+        p2 = atomic_load_explicit(&comp[low], memory_order_relaxed);
+    }
+}
+
+// Phase: link every vertex with its round-th neighbor
+static void linkNeighborRound(CCShared *shared, int begin, int end) {
+    CSRGraph *g = shared->g;
+    for (int v = begin; v < end; v++) {
+        long long i = g->rowOffsets[v] + shared->round;
+        if (i < g->rowOffsets[v + 1]) {
+            linkVertices(shared->comp, v, g->neighbors[i]);
+        }
+    }
+}
+
+// Phase: point every vertex directly at its root (pointer jumping)
+static void compressRange(CCShared *shared, int begin, int end) {
+    atomic_int *comp = shared->comp;
+    for (int v = begin; v < end; v++) {
+        int parent = atomic_load_explicit(&comp[v], memory_order_relaxed);
+        int grand = atomic_load_explicit(&comp[parent], memory_order_relaxed);
+        while (parent != grand) {
+            atomic_store_explicit(&comp[v], grand, memory_order_relaxed);
+            parent = grand;
+            grand = atomic_load_explicit(&comp[parent], memory_order_relaxed);
+        }
+    }
+}
+
+// Phase: link the remaining neighbors of vertices outside the sampled giant
+// component; edges inside it cannot merge anything new
+static void linkRemaining(CCShared *shared, int begin, int end) {
+    CSRGraph *g = shared->g;
+    for (int v = begin; v < end; v++) {
+        if (atomic_load_explicit(&shared->comp[v], memory_order_relaxed) == shared->skipComponent) {
+            continue;
+        }
+        for (long long i = g->rowOffsets[v] + NEIGHBOR_ROUNDS; i < g->rowOffsets[v + 1]; i++) {
+            linkVertices(shared->comp, v, g->neighbors[i]);
+        }
+    }
+}
+
+// Phase: link every edge (plain parallel union-find, no sampling)
+static void linkAllEdges(CCShared *shared, int begin, int end) {
+    CSRGraph *g = shared->g;
+    for (int v = begin; v < end; v++) {
+        for (long long i = g->rowOffsets[v]; i < g->rowOffsets[v + 1]; i++) {
+            if (g->neighbors[i] < v) {
+                linkVertices(shared->comp, v, g->neighbors[i]);
+            }
+        }
+    }
+}
+
+static void* phaseWorker(void *arg) {
+    PhaseArgs *args = (PhaseArgs*)arg;
+    args->phase(args->shared, args->begin, args->end);
+    return NULL;
+}
+
+// Function to run one phase over all vertices, split into contiguous ranges
+static void runPhase(CCShared *shared, PhaseFunction phase, int numThreads) {
+    pthread_t threads[MAX_THREADS];
+    PhaseArgs args[MAX_THREADS];
+    int n = shared->g->numVertices;
+
+    for (int t = 0; t < numThreads; t++) {
+        args[t].shared = shared;
+        args[t].phase = phase;
+        args[t].begin = (int)((long long)n * t / numThreads);
+        args[t].end = (int)((long long)n * (t + 1) / numThreads);
+        if (t > 0) {
+            if (pthread_create(&threads[t], NULL, phaseWorker, &args[t]) != 0) {
+                printf("Thread creation failed!\n");
+                exit(1);
+            }
+        }
+    }
+    phaseWorker(&args[0]);
+    for (int t = 1; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+}
+
+// Function to find the most frequent root among sampled vertices
+static int sampleFrequentComponent(atomic_int *comp, int n) {
+    int samples[NUM_SAMPLES];
+    uint64_t state = 31;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        samples[i] = atomic_load(&comp[nextRandom(&state) % n]);
+    }
+    qsort(samples, NUM_SAMPLES, sizeof(int), compareInts);
+
+    int best = samples[0];
+    int bestCount = 0;
+    for (int i = 0; i < NUM_SAMPLES;) {
+        int j = i;
+        while (j < NUM_SAMPLES && samples[j] == samples[i]) {
+            j++;
+        }
+        if (j - i > bestCount) {
+            bestCount = j - i;
+            best = samples[i];
+        }
+        i = j;
+    }
+    return best;
+}
+
+static Components* finishComponents(CCShared *shared, int n) {
+    int *label = (int*)allocOrExit(sizeof(int) * n);
+    for (int v = 0; v < n; v++) {
+        label[v] = atomic_load_explicit(&shared->comp[v], memory_order_relaxed);
+    }
+    Components *c = buildComponents(label, n);
+    free(label);
+    free(shared->comp);
+    return c;
+}
+
+// Connected components with Afforest: link a couple of neighbors per vertex,
+// compress, sample to find the giant component, then process the remaining
+// edges only for vertices outside it
+Components* componentsAfforest(CSRGraph *g, int numThreads) {
+    int n = g->numVertices;
+    CCShared shared;
+    shared.g = g;
+    shared.comp = (atomic_int*)allocOrExit(sizeof(atomic_int) * n);
+    for (int v = 0; v < n; v++) {
+        atomic_init(&shared.comp[v], v);
+    }
+
+    for (shared.round = 0; shared.round < NEIGHBOR_ROUNDS; shared.round++) {
+        runPhase(&shared, linkNeighborRound, numThreads);
+        runPhase(&shared, compressRange, numThreads);
+    }
+
+    shared.skipComponent = sampleFrequentComponent(shared.comp, n);
+    runPhase(&shared, linkRemaining, numThreads);
+    runPhase(&shared, compressRange, numThreads);
+
+    return finishComponents(&shared, n);
+}
+
+// Connected components with plain parallel union-find over every edge
+Components* componentsUnionFind(CSRGraph *g, int numThreads) {
+    int n = g->numVertices;
+    CCShared shared;
+    shared.g = g;
+    shared.comp = (atomic_int*)allocOrExit(sizeof(atomic_int) * n);
+    for (int v = 0; v < n; v++) {
+        atomic_init(&shared.comp[v], v);
+    }
+
+    runPhase(&shared, linkAllEdges, numThreads);
+    runPhase(&shared, compressRange, numThreads);
+
+    return finishComponents(&shared, n);
+}
+
+// ==================== BENCHMARK ====================
+
+void printComponentSummary(Components *c) {
+    int singletons = 0;
+    for (int id = 0; id < c->numComponents; id++) {
+        if (c->componentSize[id] == 1) {
+            singletons++;
+        }
+    }
+    printf("Components: %d (largest %d vertices, %d isolated vertices); connected: %s\n",
+           c->numComponents, c->componentSize[c->largest], singletons, isConnected(c) ? "yes" : "no");
+}
+
+void runBenchmark(const char *name, CSRGraph *g, int maxThreads) {
+    printf("\n%s: %d vertices, %lld adjacency entries\n", name, g->numVertices, g->numEdges);
+
+    double start = getTimeSeconds();
+    Components *reference = componentsDFS(g);
+    double dfsTime = getTimeSeconds() - start;
+    printComponentSummary(reference);
+
+    printf("%-22s %8s %10s %10s %8s\n", "Method", "Threads", "ms", "vs DFS", "Same");
+    printf("------------------------------------------------------------\n");
+    printf("%-22s %8d %10.1f %9.2fx %8s\n", "Repeated DFS", 1, dfsTime * 1000, 1.0, "-");
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        start = getTimeSeconds();
+        Components *c = componentsUnionFind(g, threads);
+        double t = getTimeSeconds() - start;
+        printf("%-22s %8d %10.1f %9.2fx %8s\n", "Union-find (all edges)", threads, t * 1000,
+               dfsTime / t, samePartition(reference, c) ? "yes" : "NO");
+        freeComponents(c);
+
+        start = getTimeSeconds();
+        c = componentsAfforest(g, threads);
+        t = getTimeSeconds() - start;
+        printf("%-22s %8d %10.1f %9.2fx %8s\n", "Afforest", threads, t * 1000,
+               dfsTime / t, samePartition(reference, c) ? "yes" : "NO");
+        freeComponents(c);
+    }
+
+    freeComponents(reference);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  CONNECTED COMPONENTS\n");
+    printf("  Parallel Lock-Free Union-Find\n");
+    printf("=========================================\n\n");
+
+    // Program 5's example graph plus a separate triangle and an isolated vertex
+    printf("Example graph with 10 vertices:\n\n");
+    printf("    0 --- 1 --- 2      6 --- 7\n");
+    printf("    |     |     |       \\   /\n");
+    printf("    3 --- 4 --- 5         8        9\n");
+
+    Edge demoEdges[] = {{0, 1}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {4, 5},
+                        {6, 7}, {7, 8}, {6, 8}};
+    CSRGraph *g = buildCSR(10, demoEdges, 10);
+    Components *c = componentsAfforest(g, 2);
+
+    printf("\nComponent IDs:\n");
+    for (int v = 0; v < 10; v++) {
+        printf("  vertex %d -> component %d (size %d)\n", v, c->componentId[v],
+               c->componentSize[c->componentId[v]]);
+    }
+    printComponentSummary(c);
+    printf("sameComponent(0, 5) = %s\n", sameComponent(c, 0, 5) ? "true" : "false");
+    printf("sameComponent(2, 7) = %s\n", sameComponent(c, 2, 7) ? "true" : "false");
+    freeComponents(c);
+    freeCSR(g);
+
+    int numVertices = 1 << 22;
+    int maxThreads = 8;
+    if (argc > 1) {
+        numVertices = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        maxThreads = atoi(argv[2]);
+    }
+    if (numVertices < 2 || maxThreads < 1 || maxThreads > MAX_THREADS) {
+        printf("Usage: %s [numVertices] [maxThreads 1-%d]\n", argv[0], MAX_THREADS);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (Online CPUs: %ld):\n", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("-------------------------------------------");
+
+    // Average degree 1.5: many small components around one giant component
+    Edge *edges = randomEdges(numVertices, numVertices * 3LL / 4, 9);
+    g = buildCSR(numVertices, edges, numVertices * 3LL / 4);
+    free(edges);
+    runBenchmark("Sparse uniform graph", g, maxThreads);
+    freeCSR(g);
+
+    // Skewed degrees with one giant component
+    int scale = 0;
+    while ((1 << (scale + 1)) <= numVertices) {
+        scale++;
+    }
+    edges = generateRMAT(scale, 8LL << scale, 12345);
+    g = buildCSR(1 << scale, edges, 8LL << scale);
+    free(edges);
+    runBenchmark("R-MAT graph", g, maxThreads);
+    freeCSR(g);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,752 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#define MAX_THREADS 64
+#define GRAPH_MAGIC 0x47525343u   // "CSRG" in little-endian byte order
+#define GRAPH_VERSION 1
+#define FLAG_WEIGHTED 1u
+#define FLAG_DIRECTED 2u
+
+// Edge in an edge list (weight is 1 for unweighted lines)
+typedef struct {
+    int src;
+    int dest;
+    int weight;
+} Edge;
+
+// Graph in compressed sparse row form (see Program 15). The arrays either
+// point into heap memory or straight into a memory-mapped file.
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries
+    bool weighted;
+    bool directed;
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+    int *weights;             // numEdges entries, or NULL if unweighted
+    void *mapping;            // Non-NULL when the arrays live in an mmap
+    size_t mappingSize;
+} CSRGraph;
+
+// Binary file header; the arrays follow at the recorded byte offsets, each
+// 8-byte aligned so they can be used in place after mmap
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t reserved;
+    uint64_t numVertices;
+    uint64_t numEdges;
+    uint64_t offsetsPos;
+    uint64_t neighborsPos;
+    uint64_t weightsPos;      // 0 if unweighted
+    uint64_t fileSize;
+} GraphFileHeader;
+
+// Parsed edge list
+typedef struct {
+    Edge *edges;
+    long long numEdges;
+    int numVertices;          // Largest vertex id + 1
+    bool weighted;
+} EdgeList;
+
+// One thread's share of the text
+typedef struct {
+    const char *begin;
+    const char *end;
+    Edge *edges;
+    long long count;
+    long long capacity;
+    int maxVertex;
+    bool weighted;
+    long long errorOffset;    // Offset of the first malformed line from begin, or -1
+} ParseChunk;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== TEXT PARSER ====================
+
+static inline bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static inline const char* skipBlanks(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+        p++;
+    }
+    return p;
+}
+
+static inline const char* skipLine(const char *p, const char *end) {
+    while (p < end && *p != '\n') {
+        p++;
+    }
+    return p < end ? p + 1 : end;
+}
+
+// Function to parse a decimal integer; returns NULL if there is no digit
+static inline const char* parseInt(const char *p, const char *end, long long *value) {
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        p++;
+    }
+    if (p >= end || !isDigit(*p)) {
+        return NULL;
+    }
+    long long v = 0;
+    while (p < end && isDigit(*p)) {
+        if (v <= INT64_MAX / 10 - 9) {                  // saturate; callers range-check
+            v = v * 10 + (*p - '0');
+        }
+        p++;
+    }
+    *value = negative ? -v : v;
+    return p;
+}
+
+// Function to check that a parsed line has nothing left but blanks or a '#' comment
+static inline bool atLineEnd(const char *p, const char *end) {
+    p = skipBlanks(p, end);
+    return p >= end || *p == '\n' || *p == '#';
+}
+
+// Function to parse "src dest [weight]" lines in [begin, end). Blank lines
+// and lines starting with '#' or '%' are skipped. Weights must fit in an int
+// and a line may only end in blanks or a '#' comment, so "1 2.5" and "1 2x"
+// are errors rather than silently truncated edges.
+void parseChunk(ParseChunk *chunk) {
+    const char *p = chunk->begin;
+    const char *end = chunk->end;
+    chunk->count = 0;
+    chunk->maxVertex = -1;
+    chunk->weighted = false;
+    chunk->errorOffset = -1;
+
+    while (p < end) {
+        const char *lineStart = p;
+        p = skipBlanks(p, end);
+        if (p >= end) {
+            break;
+        }
+        if (*p == '\n' || *p == '#' || *p == '%') {
+            p = skipLine(p, end);
+            continue;
+        }
+
+        long long src, dest, weight = 1;
+        p = parseInt(p, end, &src);
+        if (p != NULL) {
+            p = parseInt(skipBlanks(p, end), end, &dest);
+        }
+        if (p == NULL || src < 0 || dest < 0 || src > INT32_MAX - 2 || dest > INT32_MAX - 2) {
+            chunk->errorOffset = lineStart - chunk->begin;
+            return;
+        }
+        p = skipBlanks(p, end);
+        if (p < end && (isDigit(*p) || *p == '-')) {
+            p = parseInt(p, end, &weight);
+            if (p == NULL || weight < INT32_MIN || weight > INT32_MAX) {
+                chunk->errorOffset = lineStart - chunk->begin;
+                return;
+            }
+            chunk->weighted = true;
+        }
+        if (!atLineEnd(p, end)) {
+            chunk->errorOffset = lineStart - chunk->begin;
+            return;
+        }
+        p = skipLine(p, end);
+
+        if (chunk->count == chunk->capacity) {
+            chunk->capacity = chunk->capacity > 0 ? chunk->capacity * 2 : 1 << 16;
+            chunk->edges = (Edge*)realloc(chunk->edges, sizeof(Edge) * chunk->capacity);
+            if (chunk->edges == NULL) {
+                printf("Memory allocation failed!\n");
+                exit(1);
+            }
+        }
+        Edge *e = &chunk->edges[chunk->count++];
+        e->src = (int)src;
+        e->dest = (int)dest;
+        e->weight = (int)weight;
+        if (src > chunk->maxVertex) {
+            chunk->maxVertex = (int)src;
+        }
+        if (dest > chunk->maxVertex) {
+            chunk->maxVertex = (int)dest;
+        }
+    }
+}
+
+static void* parseWorker(void *arg) {
+    parseChunk((ParseChunk*)arg);
+    return NULL;
+}
+
+// Function to parse a text edge list with numThreads threads. The file is
+// mapped read-only and split into chunks that start after a newline.
+bool loadEdgeList(const char *path, int numThreads, EdgeList *list) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Cannot open %s\n", path);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size_t size = st.st_size;
+    const char *text = "";
+    if (size > 0) {
+        text = (const char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (text == MAP_FAILED) {
+            printf("Cannot map %s\n", path);
+            close(fd);
+            return false;
+        }
+        madvise((void*)text, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    ParseChunk chunks[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    const char *fileEnd = text + size;
+    for (int t = 0; t < numThreads; t++) {
+        const char *begin = text + size * t / numThreads;
+        if (t > 0 && begin > text && begin[-1] != '\n') {
+            begin = skipLine(begin, fileEnd);
+        }
+        if (t > 0 && begin < chunks[t - 1].begin) {
+            begin = chunks[t - 1].begin;  // A line longer than a chunk
+        }
+        chunks[t].begin = begin;
+        chunks[t].edges = NULL;
+        chunks[t].capacity = 0;
+    }
+    for (int t = 0; t < numThreads; t++) {
+        chunks[t].end = t + 1 < numThreads ? chunks[t + 1].begin : fileEnd;
+    }
+
+    for (int t = 1; t < numThreads; t++) {
+        if (pthread_create(&threads[t], NULL, parseWorker, &chunks[t]) != 0) {
+            printf("Thread creation failed!\n");
+            exit(1);
+        }
+    }
+    parseChunk(&chunks[0]);
+    for (int t = 1; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    // Concatenate the chunks in file order
+    bool ok = true;
+    list->numEdges = 0;
+    list->numVertices = 0;
+    list->weighted = false;
+    for (int t = 0; t < numThreads; t++) {
+        if (chunks[t].errorOffset >= 0 && ok) {
+            long long offset = chunks[t].begin - text + chunks[t].errorOffset;
+            printf("Malformed line at byte offset %lld in %s\n", offset, path);
+            ok = false;
+        }
+        list->numEdges += chunks[t].count;
+        if (chunks[t].maxVertex + 1 > list->numVertices) {
+            list->numVertices = chunks[t].maxVertex + 1;
+        }
+        list->weighted = list->weighted || chunks[t].weighted;
+    }
+
+    list->edges = (Edge*)allocOrExit(sizeof(Edge) * (list->numEdges > 0 ? list->numEdges : 1));
+    long long pos = 0;
+    for (int t = 0; t < numThreads; t++) {
+        if (chunks[t].count > 0) {
+            memcpy(list->edges + pos, chunks[t].edges, sizeof(Edge) * chunks[t].count);
+            pos += chunks[t].count;
+        }
+        free(chunks[t].edges);
+    }
+
+    if (size > 0) {
+        munmap((void*)text, size);
+    }
+    if (!ok) {
+        free(list->edges);
+        list->edges = NULL;
+    }
+    return ok;
+}
+
+// Function to parse the same file with fscanf, the way Programs 5 and 7 read edges
+bool loadEdgeListScanf(const char *path, EdgeList *list) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        return false;
+    }
+    long long capacity = 1 << 16;
+    list->edges = (Edge*)allocOrExit(sizeof(Edge) * capacity);
+    list->numEdges = 0;
+    list->numVertices = 0;
+    list->weighted = true;
+
+    int src, dest, weight;
+    int matched;
+    while ((matched = fscanf(file, "%d %d %d", &src, &dest, &weight)) != EOF) {
+        if (matched != 3) {
+            // Comment line: skip it
+            if (fscanf(file, "%*[^\n]") == EOF) {
+                break;
+            }
+            continue;
+        }
+        if (list->numEdges == capacity) {
+            capacity *= 2;
+            list->edges = (Edge*)realloc(list->edges, sizeof(Edge) * capacity);
+            if (list->edges == NULL) {
+                printf("Memory allocation failed!\n");
+                exit(1);
+            }
+        }
+        Edge *e = &list->edges[list->numEdges++];
+        e->src = src;
+        e->dest = dest;
+        e->weight = weight;
+        if (src >= list->numVertices) {
+            list->numVertices = src + 1;
+        }
+        if (dest >= list->numVertices) {
+            list->numVertices = dest + 1;
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+// ==================== CSR ====================
+
+// Function to build CSR from an edge list in O(V + E). Edges keep their input
+// order within each row; for undirected graphs each edge is stored both ways.
+CSRGraph* buildCSR(EdgeList *list, bool directed) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    int n = list->numVertices;
+    g->numVertices = n;
+    g->weighted = list->weighted;
+    g->directed = directed;
+    g->mapping = NULL;
+    g->mappingSize = 0;
+    g->rowOffsets = (long long*)calloc((size_t)n + 1, sizeof(long long));
+    if (g->rowOffsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < list->numEdges; e++) {
+        g->rowOffsets[list->edges[e].src + 1]++;
+        if (!directed && list->edges[e].src != list->edges[e].dest) {
+            g->rowOffsets[list->edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        g->rowOffsets[v + 1] += g->rowOffsets[v];
+    }
+    g->numEdges = g->rowOffsets[n];
+
+    g->neighbors = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+    g->weights = g->weighted ? (int*)allocOrExit(sizeof(int) * (g->numEdges + 1)) : NULL;
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * ((size_t)n + 1));
+    memcpy(cursor, g->rowOffsets, sizeof(long long) * ((size_t)n + 1));
+
+    for (long long e = 0; e < list->numEdges; e++) {
+        Edge *edge = &list->edges[e];
+        long long i = cursor[edge->src]++;
+        g->neighbors[i] = edge->dest;
+        if (g->weighted) {
+            g->weights[i] = edge->weight;
+        }
+        if (!directed && edge->src != edge->dest) {
+            i = cursor[edge->dest]++;
+            g->neighbors[i] = edge->src;
+            if (g->weighted) {
+                g->weights[i] = edge->weight;
+            }
+        }
+    }
+
+    free(cursor);
+    return g;
+}
+
+// Function to free a graph, whether heap-allocated or mapped
+void freeCSR(CSRGraph *g) {
+    if (g->mapping != NULL) {
+        munmap(g->mapping, g->mappingSize);
+    } else {
+        free(g->rowOffsets);
+        free(g->neighbors);
+        free(g->weights);
+    }
+    free(g);
+}
+
+// ==================== BINARY FORMAT ====================
+
+static uint64_t alignTo8(uint64_t value) {
+    return (value + 7) & ~7ULL;
+}
+
+// Function to save a CSR graph: header, then each array in one fwrite
+bool saveGraph(CSRGraph *g, const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    GraphFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = GRAPH_MAGIC;
+    header.version = GRAPH_VERSION;
+    header.flags = (g->weighted ? FLAG_WEIGHTED : 0) | (g->directed ? FLAG_DIRECTED : 0);
+    header.numVertices = g->numVertices;
+    header.numEdges = g->numEdges;
+    header.offsetsPos = alignTo8(sizeof(header));
+    header.neighborsPos = header.offsetsPos + sizeof(long long) * (header.numVertices + 1);
+    uint64_t end = header.neighborsPos + sizeof(int) * header.numEdges;
+    if (g->weighted) {
+        header.weightsPos = alignTo8(end);
+        end = header.weightsPos + sizeof(int) * header.numEdges;
+    }
+    header.fileSize = end;
+
+    static const char padding[8] = {0};
+    uint64_t neighborsEnd = header.neighborsPos + sizeof(int) * header.numEdges;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(padding, 1, header.offsetsPos - sizeof(header), file) == header.offsetsPos - sizeof(header) &&
+              fwrite(g->rowOffsets, sizeof(long long), header.numVertices + 1, file) == header.numVertices + 1 &&
+              fwrite(g->neighbors, sizeof(int), header.numEdges, file) == header.numEdges;
+    if (ok && g->weighted) {
+        ok = fwrite(padding, 1, header.weightsPos - neighborsEnd, file) == header.weightsPos - neighborsEnd &&
+             fwrite(g->weights, sizeof(int), header.numEdges, file) == header.numEdges;
+    }
+    ok = fclose(file) == 0 && ok;
+    return ok;
+}
+
+// Function to check that count elements of elementSize bytes starting at pos
+// lie inside a file of fileSize bytes; written so that nothing can wrap
+static bool sectionFits(uint64_t pos, uint64_t count, uint64_t elementSize, uint64_t fileSize) {
+    return pos % 8 == 0 && pos <= fileSize && count <= (fileSize - pos) / elementSize;
+}
+
+// Function to map a saved graph: no parsing and no copying, the CSR arrays
+// point into the file's pages, which the kernel loads on first touch. The
+// header and the first and last row offsets are always checked; verify adds
+// an O(V + E) scan that the row offsets never decrease and that every
+// neighbor id is a vertex, which is what makes traversals safe on a file
+// that was not written by this process.
+CSRGraph* mapGraph(const char *path, bool verify) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Cannot open %s\n", path);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(GraphFileHeader)) {
+        printf("%s is not a graph file\n", path);
+        close(fd);
+        return NULL;
+    }
+    void *mapping = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        printf("Cannot map %s\n", path);
+        return NULL;
+    }
+
+    const GraphFileHeader *header = (const GraphFileHeader*)mapping;
+    const char *base = (const char*)mapping;
+    bool weighted = (header->flags & FLAG_WEIGHTED) != 0;
+    bool valid = header->magic == GRAPH_MAGIC && header->version == GRAPH_VERSION &&
+                 header->fileSize == (uint64_t)st.st_size && header->numVertices < INT32_MAX &&
+                 header->numEdges <= INT64_MAX &&
+                 header->offsetsPos >= sizeof(GraphFileHeader) &&
+                 sectionFits(header->offsetsPos, header->numVertices + 1, sizeof(long long), header->fileSize) &&
+                 sectionFits(header->neighborsPos, header->numEdges, sizeof(int), header->fileSize) &&
+                 (!weighted || sectionFits(header->weightsPos, header->numEdges, sizeof(int), header->fileSize));
+    if (valid) {
+        const long long *offsets = (const long long*)(base + header->offsetsPos);
+        valid = offsets[0] == 0 && offsets[header->numVertices] == (long long)header->numEdges;
+        for (uint64_t v = 0; valid && verify && v < header->numVertices; v++) {
+            valid = offsets[v] <= offsets[v + 1];
+        }
+        const int *neighbors = (const int*)(base + header->neighborsPos);
+        for (uint64_t k = 0; valid && verify && k < header->numEdges; k++) {
+            valid = neighbors[k] >= 0 && (uint64_t)neighbors[k] < header->numVertices;
+        }
+    }
+    if (!valid) {
+        printf("%s is not a valid graph file\n", path);
+        munmap(mapping, st.st_size);
+        return NULL;
+    }
+
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    g->numVertices = (int)header->numVertices;
+    g->numEdges = (long long)header->numEdges;
+    g->weighted = weighted;
+    g->directed = (header->flags & FLAG_DIRECTED) != 0;
+    g->rowOffsets = (long long*)(base + header->offsetsPos);
+    g->neighbors = (int*)(base + header->neighborsPos);
+    g->weights = weighted ? (int*)(base + header->weightsPos) : NULL;
+    g->mapping = mapping;
+    g->mappingSize = st.st_size;
+    return g;
+}
+
+// ==================== USING THE GRAPH ====================
+
+// BFS from startVertex; returns the number of vertices reached
+int BFS(CSRGraph *g, int startVertex) {
+    bool *visited = (bool*)calloc(g->numVertices, sizeof(bool));
+    int *queue = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    if (visited == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    int head = 0;
+    int tail = 0;
+    visited[startVertex] = true;
+    queue[tail++] = startVertex;
+    while (head < tail) {
+        int u = queue[head++];
+        for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+            int v = g->neighbors[i];
+            if (!visited[v]) {
+                visited[v] = true;
+                queue[tail++] = v;
+            }
+        }
+    }
+    free(visited);
+    free(queue);
+    return tail;
+}
+
+bool sameGraph(CSRGraph *a, CSRGraph *b) {
+    if (a->numVertices != b->numVertices || a->numEdges != b->numEdges || a->weighted != b->weighted) {
+        return false;
+    }
+    return memcmp(a->rowOffsets, b->rowOffsets, sizeof(long long) * ((size_t)a->numVertices + 1)) == 0 &&
+           memcmp(a->neighbors, b->neighbors, sizeof(int) * a->numEdges) == 0 &&
+           (!a->weighted || memcmp(a->weights, b->weights, sizeof(int) * a->numEdges) == 0);
+}
+
+void printGraphInfo(CSRGraph *g) {
+    printf("%d vertices, %lld adjacency entries, %s, %s\n", g->numVertices, g->numEdges,
+           g->weighted ? "weighted" : "unweighted", g->directed ? "directed" : "undirected");
+}
+
+// Function to write a random weighted edge list as text
+bool writeRandomEdgeList(const char *path, int numVertices, long long numEdges, bool weighted) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return false;
+    }
+    uint64_t state = 2718;
+    fprintf(file, "# src dest%s\n", weighted ? " weight" : "");
+    for (long long e = 0; e < numEdges; e++) {
+        uint64_t r = nextRandom(&state);
+        int src = (int)((r & 0xFFFFFFFFu) % (uint64_t)numVertices);
+        int dest = (int)((r >> 32) % (uint64_t)numVertices);
+        if (weighted) {
+            fprintf(file, "%d %d %d\n", src, dest, (int)(nextRandom(&state) % 100) + 1);
+        } else {
+            fprintf(file, "%d %d\n", src, dest);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+// ==================== COMMANDS ====================
+
+int convertFile(const char *textPath, const char *graphPath, bool directed, int numThreads) {
+    EdgeList list;
+    double start = getTimeSeconds();
+    if (!loadEdgeList(textPath, numThreads, &list)) {
+        return 1;
+    }
+    double parseTime = getTimeSeconds() - start;
+    printf("Parsed %lld edges in %.3f s with %d threads (%.1f M edges/s)\n",
+           list.numEdges, parseTime, numThreads, list.numEdges / parseTime / 1e6);
+
+    start = getTimeSeconds();
+    CSRGraph *g = buildCSR(&list, directed);
+    free(list.edges);
+    printf("Built CSR in %.3f s: ", getTimeSeconds() - start);
+    printGraphInfo(g);
+
+    start = getTimeSeconds();
+    bool ok = saveGraph(g, graphPath);
+    printf("%s %s in %.3f s\n", ok ? "Saved" : "FAILED to save", graphPath, getTimeSeconds() - start);
+    freeCSR(g);
+    return ok ? 0 : 1;
+}
+
+int loadFile(const char *graphPath, bool verify) {
+    double start = getTimeSeconds();
+    CSRGraph *g = mapGraph(graphPath, verify);
+    if (g == NULL) {
+        return 1;
+    }
+    printf("%s %s in %.3f ms: ", verify ? "Mapped and validated" : "Mapped", graphPath,
+           (getTimeSeconds() - start) * 1000);
+    printGraphInfo(g);
+    if (g->numVertices > 0) {
+        start = getTimeSeconds();
+        int reached = BFS(g, 0);
+        printf("BFS from vertex 0 reached %d vertices in %.3f s\n", reached, getTimeSeconds() - start);
+    }
+    freeCSR(g);
+    return 0;
+}
+
+void printUsage(const char *program) {
+    printf("Usage:\n");
+    printf("  %s                                          run the demo\n", program);
+    printf("  %s convert <edges.txt> <graph.csr> [directed|undirected] [threads]\n", program);
+    printf("  %s load <graph.csr> [trusted]               map, validate and run BFS\n", program);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  GRAPH LOADER\n");
+    printf("  Text Edge List -> CSR -> mmap\n");
+    printf("=========================================\n\n");
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    int defaultThreads = online < 1 ? 1 : (online > MAX_THREADS ? MAX_THREADS : (int)online);
+
+    if (argc >= 4 && strcmp(argv[1], "convert") == 0) {
+        bool directed = argc >= 5 && strcmp(argv[4], "directed") == 0;
+        int threads = argc >= 6 ? atoi(argv[5]) : defaultThreads;
+        if (threads < 1 || threads > MAX_THREADS) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        return convertFile(argv[2], argv[3], directed, threads);
+    }
+    if (argc >= 3 && strcmp(argv[1], "load") == 0) {
+        return loadFile(argv[2], !(argc >= 4 && strcmp(argv[3], "trusted") == 0));
+    }
+    if (argc > 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Demo: Program 7's example style, weighted and undirected
+    const char *textPath = "demo_edges.txt";
+    const char *graphPath = "demo_graph.csr";
+    int numVertices = 1000000;
+    long long numEdges = 8000000;
+
+    printf("Writing random weighted edge list: %d vertices, %lld edges...\n", numVertices, numEdges);
+    if (!writeRandomEdgeList(textPath, numVertices, numEdges, true)) {
+        printf("Cannot create %s\n", textPath);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Parsing (Online CPUs: %ld):\n", online);
+    printf("-------------------------------------------\n");
+    EdgeList reference;
+    double start = getTimeSeconds();
+    loadEdgeListScanf(textPath, &reference);
+    double scanfTime = getTimeSeconds() - start;
+    printf("%-26s %8.3f s  %7.1f M edges/s\n", "fscanf(\"%d %d %d\")", scanfTime, reference.numEdges / scanfTime / 1e6);
+
+    EdgeList list;
+    for (int threads = 1; threads <= 4; threads *= 2) {
+        start = getTimeSeconds();
+        if (!loadEdgeList(textPath, threads, &list)) {
+            return 1;
+        }
+        double t = getTimeSeconds() - start;
+        bool same = list.numEdges == reference.numEdges &&
+                    memcmp(list.edges, reference.edges, sizeof(Edge) * list.numEdges) == 0;
+        char name[64];
+        snprintf(name, sizeof(name), "Hand parser, %d thread%s", threads, threads > 1 ? "s" : "");
+        printf("%-26s %8.3f s  %7.1f M edges/s  %5.1fx  same edges: %s\n", name, t,
+               list.numEdges / t / 1e6, scanfTime / t, same ? "yes" : "NO");
+        if (threads < 4) {
+            free(list.edges);
+        }
+    }
+    free(reference.edges);
+
+    printf("\n-------------------------------------------\n");
+    printf("CSR and Binary File:\n");
+    printf("-------------------------------------------\n");
+    start = getTimeSeconds();
+    CSRGraph *built = buildCSR(&list, false);
+    free(list.edges);
+    printf("Built CSR in %.3f s: ", getTimeSeconds() - start);
+    printGraphInfo(built);
+
+    start = getTimeSeconds();
+    bool saved = saveGraph(built, graphPath);
+    printf("Saved %s in %.3f s\n", graphPath, getTimeSeconds() - start);
+
+    if (saved) {
+        start = getTimeSeconds();
+        CSRGraph *mapped = mapGraph(graphPath, false);
+        double mapTime = getTimeSeconds() - start;
+        if (mapped != NULL) {
+            printf("Mapped in %.3f ms (%.1f MB file, nothing parsed or copied)\n",
+                   mapTime * 1000, mapped->mappingSize / (1024.0 * 1024));
+            printf("Mapped graph identical to built graph: %s\n", sameGraph(built, mapped) ? "yes" : "NO");
+
+            start = getTimeSeconds();
+            int reached = BFS(mapped, 0);
+            printf("BFS on mapped graph: %d vertices reached in %.3f s\n", reached, getTimeSeconds() - start);
+            freeCSR(mapped);
+        }
+    }
+    freeCSR(built);
+    remove(textPath);
+    remove(graphPath);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
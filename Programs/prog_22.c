@@ -0,0 +1,572 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define NUM_ROOTS 64
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Undirected graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// Available generators
+typedef enum {
+    GEN_RMAT,
+    GEN_ERDOS_RENYI,
+    GEN_GRID,
+    GEN_POWER_LAW
+} GeneratorType;
+
+// Summary statistics of the per-root TEPS values
+typedef struct {
+    double min;
+    double firstQuartile;
+    double median;
+    double thirdQuartile;
+    double max;
+    double harmonicMean;
+} TEPSStats;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// Function to seed the generator; xorshift must never hold zero
+static inline uint64_t seedRandom(uint64_t seed) {
+    uint64_t state = seed * 0x9E3779B97F4A7C15ULL + 0x2545F4914F6CDD1DULL;
+    return state != 0 ? state : 1;
+}
+
+// Uniform double in [0, 1)
+static inline double nextUnit(uint64_t *state) {
+    return (nextRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== CSR ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to build an undirected CSR graph with sorted, duplicate-free
+// neighbor lists and no self loops; frees the edge list
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        if (edges[e].src != edges[e].dest) {
+            offsets[edges[e].src + 1]++;
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u != v) {
+            neighbors[cursor[u]++] = v;
+            neighbors[cursor[v]++] = u;
+        }
+    }
+    free(edges);
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        qsort(neighbors + start, end - start, sizeof(int), compareInts);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+static inline long long degree(CSRGraph *g, int v) {
+    return g->rowOffsets[v + 1] - g->rowOffsets[v];
+}
+
+// Function to fingerprint a graph (FNV-1a over its arrays), so runs with the
+// same generator, size and seed can be checked to use the same graph
+uint64_t graphFingerprint(CSRGraph *g) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (int v = 0; v <= g->numVertices; v++) {
+        hash = (hash ^ (uint64_t)g->rowOffsets[v]) * 1099511628211ULL;
+    }
+    for (long long i = 0; i < g->numEdges; i++) {
+        hash = (hash ^ (uint32_t)g->neighbors[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// ==================== GENERATORS ====================
+
+// R-MAT / Kronecker generator with Graph500 parameters (a = 0.57, b = c = 0.19).
+// Vertex ids are then scrambled by a random permutation, as in Graph500, so
+// high-degree vertices are not clustered at small ids.
+CSRGraph* generateRMAT(int scale, int edgeFactor, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    int n = 1 << scale;
+    long long m = (long long)edgeFactor * n;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * m);
+    int *permutation = (int*)allocOrExit(sizeof(int) * n);
+    uint64_t state = seedRandom(seed);
+
+    for (int v = 0; v < n; v++) {
+        permutation[v] = v;
+    }
+    for (int v = n - 1; v > 0; v--) {
+        int j = nextRandom(&state) % (v + 1);
+        int t = permutation[v];
+        permutation[v] = permutation[j];
+        permutation[j] = t;
+    }
+
+    for (long long e = 0; e < m; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = nextUnit(&state);
+            if (r >= a && r < a + b) {
+                v |= 1 << bit;
+            } else if (r >= a + b && r < a + b + c) {
+                u |= 1 << bit;
+            } else if (r >= a + b + c) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = permutation[u];
+        edges[e].dest = permutation[v];
+    }
+
+    free(permutation);
+    return buildCSR(n, edges, m);
+}
+
+// Erdős–Rényi G(n, m): m edges with uniformly random endpoints
+CSRGraph* generateErdosRenyi(int numVertices, long long numEdges, uint64_t seed) {
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seedRandom(seed);
+    for (long long e = 0; e < numEdges; e++) {
+        edges[e].src = nextRandom(&state) % numVertices;
+        edges[e].dest = nextRandom(&state) % numVertices;
+    }
+    return buildCSR(numVertices, edges, numEdges);
+}
+
+// 2D grid (rows x cols, 4-neighbor), written straight into CSR: each row is
+// already sorted (up, left, right, down), so no edge list is needed
+CSRGraph* generateGrid(int rows, int cols) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    int n = rows * cols;
+    g->numVertices = n;
+    g->rowOffsets = (long long*)allocOrExit(sizeof(long long) * (n + 1));
+    g->numEdges = 2LL * ((long long)rows * (cols - 1) + (long long)(rows - 1) * cols);
+    g->neighbors = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+
+    long long pos = 0;
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int v = r * cols + c;
+            g->rowOffsets[v] = pos;
+            if (r > 0) {
+                g->neighbors[pos++] = v - cols;
+            }
+            if (c > 0) {
+                g->neighbors[pos++] = v - 1;
+            }
+            if (c + 1 < cols) {
+                g->neighbors[pos++] = v + 1;
+            }
+            if (r + 1 < rows) {
+                g->neighbors[pos++] = v + cols;
+            }
+        }
+    }
+    g->rowOffsets[n] = pos;
+    return g;
+}
+
+// Power-law graph (Chung-Lu): vertex i gets weight (i + 1)^(-1 / (gamma - 1)),
+// and each edge end is drawn with probability proportional to weight, so
+// expected degrees follow a power law with exponent gamma
+CSRGraph* generatePowerLaw(int numVertices, long long numEdges, double gamma, uint64_t seed) {
+    double *cumulative = (double*)allocOrExit(sizeof(double) * numVertices);
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seedRandom(seed);
+    double exponent = -1.0 / (gamma - 1.0);
+
+    double total = 0;
+    for (int v = 0; v < numVertices; v++) {
+        total += pow(v + 1.0, exponent);
+        cumulative[v] = total;
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        int ends[2];
+        for (int k = 0; k < 2; k++) {
+            // Binary search for the first cumulative weight above a random point
+            double target = nextUnit(&state) * total;
+            int lo = 0;
+            int hi = numVertices - 1;
+            while (lo < hi) {
+                int mid = lo + (hi - lo) / 2;
+                if (cumulative[mid] <= target) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            ends[k] = lo;
+        }
+        edges[e].src = ends[0];
+        edges[e].dest = ends[1];
+    }
+
+    free(cumulative);
+    return buildCSR(numVertices, edges, numEdges);
+}
+
+const char* generatorName(GeneratorType type) {
+    switch (type) {
+        case GEN_RMAT: return "R-MAT (Kronecker)";
+        case GEN_ERDOS_RENYI: return "Erdos-Renyi G(n,m)";
+        case GEN_GRID: return "2D grid";
+        case GEN_POWER_LAW: return "Power-law (Chung-Lu)";
+    }
+    return "?";
+}
+
+// Function to build a graph with 2^scale vertices from any generator
+CSRGraph* generateGraph(GeneratorType type, int scale, int edgeFactor, uint64_t seed) {
+    int n = 1 << scale;
+    long long m = (long long)edgeFactor * n;
+    switch (type) {
+        case GEN_RMAT:
+            return generateRMAT(scale, edgeFactor, seed);
+        case GEN_ERDOS_RENYI:
+            return generateErdosRenyi(n, m, seed);
+        case GEN_GRID:
+            return generateGrid(1 << (scale / 2), 1 << (scale - scale / 2));
+        case GEN_POWER_LAW:
+            return generatePowerLaw(n, m, 2.5, seed);
+    }
+    return NULL;
+}
+
+// ==================== BFS AND VALIDATION ====================
+
+// BFS from root filling parent (-1 if unreached) and depth; queue is
+// caller-provided scratch of numVertices entries
+void BFS(CSRGraph *g, int root, int *parent, int *depth, int *queue) {
+    for (int v = 0; v < g->numVertices; v++) {
+        parent[v] = -1;
+    }
+    int head = 0;
+    int tail = 0;
+    parent[root] = root;
+    depth[root] = 0;
+    queue[tail++] = root;
+
+    while (head < tail) {
+        int u = queue[head++];
+        for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+            int v = g->neighbors[i];
+            if (parent[v] < 0) {
+                parent[v] = u;
+                depth[v] = depth[u] + 1;
+                queue[tail++] = v;
+            }
+        }
+    }
+}
+
+// Function to check a BFS parent tree (Graph500 rules):
+// 1. the root is its own parent, and every tree edge is a graph edge
+// 2. levels along tree edges increase by exactly one
+// 3. every graph edge joins vertices whose levels differ by at most one
+// 4. every graph edge has both or neither endpoint in the tree
+// Levels are recomputed from the parent array alone. Returns the number of
+// undirected edges in the traversed component (for TEPS), or -1 if invalid.
+long long validateBFS(CSRGraph *g, int root, const int *parent, int *level) {
+    int n = g->numVertices;
+    if (parent[root] != root) {
+        return -1;
+    }
+
+    // Levels from parent pointers; a cycle shows up as a chain longer than n
+    for (int v = 0; v < n; v++) {
+        level[v] = parent[v] < 0 ? -1 : -2;
+    }
+    level[root] = 0;
+    for (int v = 0; v < n; v++) {
+        if (level[v] != -2) {
+            continue;
+        }
+        int steps = 0;
+        int u = v;
+        while (level[u] == -2) {
+            u = parent[u];
+            if (u < 0 || ++steps > n) {
+                return -1;
+            }
+        }
+        int base = level[u];
+        if (base < 0) {
+            return -1;
+        }
+        // Walk again, assigning levels from the top down
+        int length = steps;
+        u = v;
+        while (level[u] == -2) {
+            level[u] = base + length--;
+            u = parent[u];
+        }
+    }
+
+    long long componentEdges = 0;
+    for (int u = 0; u < n; u++) {
+        bool inTree = parent[u] >= 0;
+        bool parentFound = u == root;
+        for (long long i = g->rowOffsets[u]; i < g->rowOffsets[u + 1]; i++) {
+            int v = g->neighbors[i];
+            bool neighborInTree = parent[v] >= 0;
+            if (inTree != neighborInTree) {
+                return -1;
+            }
+            if (inTree) {
+                int diff = level[u] - level[v];
+                if (diff > 1 || diff < -1) {
+                    return -1;
+                }
+                if (v == parent[u]) {
+                    parentFound = true;
+                }
+                componentEdges++;
+            }
+        }
+        if (inTree && (!parentFound || (u != root && level[u] != level[parent[u]] + 1))) {
+            return -1;
+        }
+    }
+    return componentEdges / 2;
+}
+
+int compareDoubles(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to summarize TEPS values; harmonic mean is the Graph500 headline
+TEPSStats summarizeTEPS(double *teps, int count) {
+    TEPSStats s;
+    qsort(teps, count, sizeof(double), compareDoubles);
+    s.min = teps[0];
+    s.firstQuartile = teps[count / 4];
+    s.median = count % 2 ? teps[count / 2] : (teps[count / 2 - 1] + teps[count / 2]) / 2;
+    s.thirdQuartile = teps[(3 * count) / 4];
+    s.max = teps[count - 1];
+    double inverseSum = 0;
+    for (int i = 0; i < count; i++) {
+        inverseSum += 1.0 / teps[i];
+    }
+    s.harmonicMean = count / inverseSum;
+    return s;
+}
+
+// Function to run the benchmark on one generated graph; returns false if any
+// BFS tree fails validation
+bool runBenchmark(GeneratorType type, int scale, int edgeFactor, uint64_t seed) {
+    printf("\n-------------------------------------------\n");
+    printf("%s, scale %d, seed %llu\n", generatorName(type), scale, (unsigned long long)seed);
+    printf("-------------------------------------------\n");
+
+    double start = getTimeSeconds();
+    CSRGraph *g = generateGraph(type, scale, edgeFactor, seed);
+    double genTime = getTimeSeconds() - start;
+
+    long long maxDegree = 0;
+    int isolated = 0;
+    for (int v = 0; v < g->numVertices; v++) {
+        long long d = degree(g, v);
+        if (d > maxDegree) {
+            maxDegree = d;
+        }
+        if (d == 0) {
+            isolated++;
+        }
+    }
+    printf("Generated in %.2f s: %d vertices, %lld undirected edges, max degree %lld, %d isolated\n",
+           genTime, g->numVertices, g->numEdges / 2, maxDegree, isolated);
+    printf("Graph fingerprint: %016llx\n", (unsigned long long)graphFingerprint(g));
+    if (g->numEdges == 0) {
+        printf("No non-isolated vertex to use as a BFS root; skipping\n");
+        freeCSR(g);
+        return true;
+    }
+
+    int *parent = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    int *depth = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    int *queue = (int*)allocOrExit(sizeof(int) * g->numVertices);
+    double teps[NUM_ROOTS];
+    double totalTime = 0;
+    bool allValid = true;
+
+    // Roots: random vertices with at least one edge (Graph500 rule)
+    uint64_t state = seedRandom(seed + 1);
+    for (int r = 0; r < NUM_ROOTS; r++) {
+        int root;
+        do {
+            root = nextRandom(&state) % g->numVertices;
+        } while (degree(g, root) == 0);
+
+        start = getTimeSeconds();
+        BFS(g, root, parent, depth, queue);
+        double t = getTimeSeconds() - start;
+        totalTime += t;
+
+        long long edges = validateBFS(g, root, parent, depth);
+        if (edges < 0) {
+            printf("Root %d: BFS tree FAILED validation\n", root);
+            allValid = false;
+            teps[r] = 0;
+        } else {
+            teps[r] = edges / t;
+        }
+    }
+
+    if (allValid) {
+        TEPSStats s = summarizeTEPS(teps, NUM_ROOTS);
+        printf("%d BFS roots, all parent trees valid, mean time %.2f ms\n",
+               NUM_ROOTS, totalTime / NUM_ROOTS * 1000);
+        printf("TEPS  min %8.2fM  q1 %8.2fM  median %8.2fM  q3 %8.2fM  max %8.2fM\n",
+               s.min / 1e6, s.firstQuartile / 1e6, s.median / 1e6, s.thirdQuartile / 1e6, s.max / 1e6);
+        printf("      harmonic mean %8.2fM\n", s.harmonicMean / 1e6);
+    }
+
+    free(parent);
+    free(depth);
+    free(queue);
+    freeCSR(g);
+    return allValid;
+}
+
+void printUsage(const char *program) {
+    printf("Usage: %s [all|rmat|er|grid|powerlaw] [scale 2-28] [edgeFactor] [seed]\n", program);
+}
+
+int main(int argc, char *argv[]) {
+    int scale = 18;
+    int edgeFactor = 16;
+    uint64_t seed = 1;
+    int first = GEN_RMAT;
+    int last = GEN_POWER_LAW;
+
+    if (argc > 1 && strcmp(argv[1], "all") != 0) {
+        const char *names[] = {"rmat", "er", "grid", "powerlaw"};
+        first = -1;
+        for (int i = 0; i < 4; i++) {
+            if (strcmp(argv[1], names[i]) == 0) {
+                first = last = i;
+            }
+        }
+        if (first < 0) {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (argc > 2) {
+        scale = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        edgeFactor = atoi(argv[3]);
+    }
+    if (argc > 4) {
+        seed = strtoull(argv[4], NULL, 10);
+    }
+    if (scale < 2 || scale > 28 || edgeFactor < 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    printf("=========================================\n");
+    printf("  GRAPH GENERATORS\n");
+    printf("  Graph500-Style BFS Benchmark (TEPS)\n");
+    printf("=========================================\n");
+    printf("\nScale %d (2^%d vertices), edge factor %d, seed %llu, %d roots per graph\n",
+           scale, scale, edgeFactor, (unsigned long long)seed, NUM_ROOTS);
+
+    bool allValid = true;
+    for (int type = first; type <= last; type++) {
+        allValid = runBenchmark((GeneratorType)type, scale, edgeFactor, seed) && allValid;
+    }
+
+    printf("\nAll BFS trees valid: %s\n", allValid ? "yes" : "NO");
+    printf("\nProgram completed successfully!\n");
+    return allValid ? 0 : 1;
+}
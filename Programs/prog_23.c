@@ -0,0 +1,700 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_ROOTS 8
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Undirected graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// A vertex relabeling and its inverse
+typedef struct {
+    const char *name;
+    int *oldToNew;
+    int *newToOld;
+    double seconds;           // Time to compute the order and rewrite the graph
+} Reordering;
+
+// DFS stack frame (see Program 19)
+typedef struct {
+    int vertex;
+    long long cursor;
+} DFSFrame;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== GRAPH ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to sort a neighbor list in place (insertion sort for short lists)
+static void sortNeighbors(int *list, long long length) {
+    if (length > 32) {
+        qsort(list, length, sizeof(int), compareInts);
+        return;
+    }
+    for (long long i = 1; i < length; i++) {
+        int key = list[i];
+        long long j = i - 1;
+        while (j >= 0 && list[j] > key) {
+            list[j + 1] = list[j];
+            j--;
+        }
+        list[j + 1] = key;
+    }
+}
+
+// Function to build an undirected CSR graph with sorted, duplicate-free
+// neighbor lists and no self loops; frees the edge list
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        if (edges[e].src != edges[e].dest) {
+            offsets[edges[e].src + 1]++;
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u != v) {
+            neighbors[cursor[u]++] = v;
+            neighbors[cursor[v]++] = u;
+        }
+    }
+    free(edges);
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        sortNeighbors(neighbors + start, end - start);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+static inline long long degree(CSRGraph *g, int v) {
+    return g->rowOffsets[v + 1] - g->rowOffsets[v];
+}
+
+// Function to generate a rows x cols grid whose vertex ids are randomly
+// shuffled, like a mesh loaded from a file in arbitrary order
+Edge* scrambledGridEdges(int rows, int cols, long long *numEdges, uint64_t seed) {
+    int n = rows * cols;
+    int *label = (int*)allocOrExit(sizeof(int) * n);
+    uint64_t state = seed;
+    for (int v = 0; v < n; v++) {
+        label[v] = v;
+    }
+    for (int v = n - 1; v > 0; v--) {
+        int j = nextRandom(&state) % (v + 1);
+        int t = label[v];
+        label[v] = label[j];
+        label[j] = t;
+    }
+
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * 2LL * n);
+    long long m = 0;
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int v = r * cols + c;
+            if (c + 1 < cols) {
+                edges[m].src = label[v];
+                edges[m++].dest = label[v + 1];
+            }
+            if (r + 1 < rows) {
+                edges[m].src = label[v];
+                edges[m++].dest = label[v + cols];
+            }
+        }
+    }
+    free(label);
+    *numEdges = m;
+    return edges;
+}
+
+// Function to generate an R-MAT graph (see Program 22) with scrambled ids
+Edge* scrambledRMATEdges(int scale, long long numEdges, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    int n = 1 << scale;
+    int *label = (int*)allocOrExit(sizeof(int) * n);
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * numEdges);
+    uint64_t state = seed;
+
+    for (int v = 0; v < n; v++) {
+        label[v] = v;
+    }
+    for (int v = n - 1; v > 0; v--) {
+        int j = nextRandom(&state) % (v + 1);
+        int t = label[v];
+        label[v] = label[j];
+        label[j] = t;
+    }
+    for (long long e = 0; e < numEdges; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0);
+            if (r >= a && r < a + b) {
+                v |= 1 << bit;
+            } else if (r >= a + b && r < a + b + c) {
+                u |= 1 << bit;
+            } else if (r >= a + b + c) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = label[u];
+        edges[e].dest = label[v];
+    }
+    free(label);
+    return edges;
+}
+
+// ==================== ORDERINGS ====================
+
+// Function to fill newToOld from oldToNew
+static void invertOrder(const int *oldToNew, int *newToOld, int n) {
+    for (int v = 0; v < n; v++) {
+        newToOld[oldToNew[v]] = v;
+    }
+}
+
+// Degree-descending order: hubs get the smallest ids and sit together in
+// memory. Counting sort on degree, stable for equal degrees.
+void orderDegreeDescending(CSRGraph *g, int *oldToNew) {
+    int n = g->numVertices;
+    long long maxDegree = 0;
+    for (int v = 0; v < n; v++) {
+        if (degree(g, v) > maxDegree) {
+            maxDegree = degree(g, v);
+        }
+    }
+    long long *start = (long long*)calloc(maxDegree + 2, sizeof(long long));
+    if (start == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    // Bucket k holds degree maxDegree - k, so higher degrees come first
+    for (int v = 0; v < n; v++) {
+        start[maxDegree - degree(g, v) + 1]++;
+    }
+    for (long long k = 0; k <= maxDegree; k++) {
+        start[k + 1] += start[k];
+    }
+    for (int v = 0; v < n; v++) {
+        oldToNew[v] = (int)start[maxDegree - degree(g, v)]++;
+    }
+    free(start);
+}
+
+// BFS order: vertices are numbered in the order a BFS reaches them, one
+// component after another, starting each component at its highest-degree
+// vertex (taken from the degree order)
+void orderBFS(CSRGraph *g, int *oldToNew) {
+    int n = g->numVertices;
+    int *byDegree = (int*)allocOrExit(sizeof(int) * n);
+    int *queue = (int*)allocOrExit(sizeof(int) * n);
+
+    orderDegreeDescending(g, oldToNew);
+    invertOrder(oldToNew, byDegree, n);
+    for (int v = 0; v < n; v++) {
+        oldToNew[v] = -1;
+    }
+
+    int next = 0;
+    for (int i = 0; i < n; i++) {
+        int s = byDegree[i];
+        if (oldToNew[s] >= 0) {
+            continue;
+        }
+        int head = 0;
+        int tail = 0;
+        oldToNew[s] = next++;
+        queue[tail++] = s;
+        while (head < tail) {
+            int u = queue[head++];
+            for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+                int v = g->neighbors[k];
+                if (oldToNew[v] < 0) {
+                    oldToNew[v] = next++;
+                    queue[tail++] = v;
+                }
+            }
+        }
+    }
+
+    free(byDegree);
+    free(queue);
+}
+
+// Function to find a pseudo-peripheral vertex of start's component (George
+// and Liu): BFS repeatedly, moving to a minimum-degree vertex of the last
+// level while that increases the number of levels. Only vertices with
+// placed[v] == false are considered; mark/stamp avoid clearing arrays.
+static int pseudoPeripheral(CSRGraph *g, int start, const int *placed, int *mark, int *stamp,
+                            int *queue, int *level) {
+    int current = start;
+    int bestLevels = -1;
+    for (int iteration = 0; iteration < 4; iteration++) {
+        (*stamp)++;
+        int head = 0;
+        int tail = 0;
+        mark[current] = *stamp;
+        level[current] = 0;
+        queue[tail++] = current;
+        while (head < tail) {
+            int u = queue[head++];
+            for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+                int v = g->neighbors[k];
+                if (mark[v] != *stamp && placed[v] < 0) {
+                    mark[v] = *stamp;
+                    level[v] = level[u] + 1;
+                    queue[tail++] = v;
+                }
+            }
+        }
+
+        int lastLevel = level[queue[tail - 1]];
+        if (lastLevel <= bestLevels) {
+            break;
+        }
+        bestLevels = lastLevel;
+
+        // Minimum-degree vertex in the last level
+        int candidate = queue[tail - 1];
+        for (int i = tail - 1; i >= 0 && level[queue[i]] == lastLevel; i--) {
+            if (degree(g, queue[i]) < degree(g, candidate)) {
+                candidate = queue[i];
+            }
+        }
+        if (candidate == current) {
+            break;
+        }
+        current = candidate;
+    }
+    return current;
+}
+
+// Reverse Cuthill-McKee: BFS from a pseudo-peripheral vertex, visiting each
+// vertex's unplaced neighbors in increasing degree order, then reverse the
+// numbering. Keeps every edge's endpoints close (small bandwidth).
+void orderRCM(CSRGraph *g, int *oldToNew) {
+    int n = g->numVertices;
+    int *order = (int*)allocOrExit(sizeof(int) * n);
+    int *mark = (int*)calloc(n, sizeof(int));
+    int *queue = (int*)allocOrExit(sizeof(int) * n);
+    int *level = (int*)allocOrExit(sizeof(int) * n);
+    long long maxDegree = 0;
+    int stamp = 0;
+    if (mark == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (int v = 0; v < n; v++) {
+        oldToNew[v] = -1;
+        if (degree(g, v) > maxDegree) {
+            maxDegree = degree(g, v);
+        }
+    }
+    int *children = (int*)allocOrExit(sizeof(int) * (maxDegree + 1));
+
+    int next = 0;
+    for (int s = 0; s < n; s++) {
+        if (oldToNew[s] >= 0) {
+            continue;
+        }
+        int root = pseudoPeripheral(g, s, oldToNew, mark, &stamp, queue, level);
+        int head = next;
+        oldToNew[root] = next;
+        order[next++] = root;
+
+        while (head < next) {
+            int u = order[head++];
+            int count = 0;
+            for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+                int v = g->neighbors[k];
+                if (oldToNew[v] < 0) {
+                    oldToNew[v] = next;  // Reserve; final slot set below
+                    children[count++] = v;
+                }
+            }
+            // Insertion sort by degree (neighbor counts are small on meshes)
+            for (int i = 1; i < count; i++) {
+                int key = children[i];
+                int j = i - 1;
+                while (j >= 0 && degree(g, children[j]) > degree(g, key)) {
+                    children[j + 1] = children[j];
+                    j--;
+                }
+                children[j + 1] = key;
+            }
+            for (int i = 0; i < count; i++) {
+                oldToNew[children[i]] = next;
+                order[next++] = children[i];
+            }
+        }
+    }
+
+    // Reverse the Cuthill-McKee numbering
+    for (int i = 0; i < n; i++) {
+        oldToNew[order[i]] = n - 1 - i;
+    }
+
+    free(order);
+    free(mark);
+    free(queue);
+    free(level);
+    free(children);
+}
+
+// Function to rewrite the graph under a relabeling: vertex newToOld[i]
+// becomes vertex i, and neighbor ids are translated and re-sorted
+CSRGraph* relabelGraph(CSRGraph *g, const int *oldToNew, const int *newToOld) {
+    int n = g->numVertices;
+    CSRGraph *r = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    r->numVertices = n;
+    r->numEdges = g->numEdges;
+    r->rowOffsets = (long long*)allocOrExit(sizeof(long long) * (n + 1));
+    r->neighbors = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+
+    long long pos = 0;
+    for (int i = 0; i < n; i++) {
+        int old = newToOld[i];
+        r->rowOffsets[i] = pos;
+        for (long long k = g->rowOffsets[old]; k < g->rowOffsets[old + 1]; k++) {
+            r->neighbors[pos++] = oldToNew[g->neighbors[k]];
+        }
+        sortNeighbors(r->neighbors + r->rowOffsets[i], pos - r->rowOffsets[i]);
+    }
+    r->rowOffsets[n] = pos;
+    return r;
+}
+
+// ==================== TRAVERSALS ====================
+
+// BFS from root; writes depth (-1 if unreached) and returns vertices reached
+int BFS(CSRGraph *g, int root, int *depth, int *queue) {
+    for (int v = 0; v < g->numVertices; v++) {
+        depth[v] = -1;
+    }
+    int head = 0;
+    int tail = 0;
+    depth[root] = 0;
+    queue[tail++] = root;
+    while (head < tail) {
+        int u = queue[head++];
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            if (depth[v] < 0) {
+                depth[v] = depth[u] + 1;
+                queue[tail++] = v;
+            }
+        }
+    }
+    return tail;
+}
+
+// Iterative DFS with (vertex, cursor) frames; returns vertices reached
+int DFS(CSRGraph *g, int root, bool *visited, DFSFrame *stack) {
+    memset(visited, 0, g->numVertices);
+    int top = 0;
+    int count = 1;
+    visited[root] = true;
+    stack[top].vertex = root;
+    stack[top++].cursor = g->rowOffsets[root];
+    while (top > 0) {
+        DFSFrame *frame = &stack[top - 1];
+        if (frame->cursor < g->rowOffsets[frame->vertex + 1]) {
+            int v = g->neighbors[frame->cursor++];
+            if (!visited[v]) {
+                visited[v] = true;
+                count++;
+                stack[top].vertex = v;
+                stack[top++].cursor = g->rowOffsets[v];
+            }
+        } else {
+            top--;
+        }
+    }
+    return count;
+}
+
+// Function to measure locality: bandwidth (largest |u - v| over edges) and
+// average |u - v|
+void edgeSpan(CSRGraph *g, long long *bandwidth, double *averageGap) {
+    long long maxGap = 0;
+    double total = 0;
+    for (int u = 0; u < g->numVertices; u++) {
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            long long gap = g->neighbors[k] > u ? g->neighbors[k] - u : u - g->neighbors[k];
+            if (gap > maxGap) {
+                maxGap = gap;
+            }
+            total += gap;
+        }
+    }
+    *bandwidth = maxGap;
+    *averageGap = g->numEdges > 0 ? total / g->numEdges : 0;
+}
+
+// ==================== BENCHMARK ====================
+
+typedef void (*OrderFunction)(CSRGraph *g, int *oldToNew);
+
+// Function to time BFS and DFS over the given roots (in original ids) on a
+// graph under a relabeling, checking depths against the original graph
+void timeTraversals(CSRGraph *g, const int *roots, const int *oldToNew, const int *newToOld,
+                    int **referenceDepths, double *bfsTime, double *dfsTime, bool *sameDepths) {
+    int n = g->numVertices;
+    int *depth = (int*)allocOrExit(sizeof(int) * n);
+    int *queue = (int*)allocOrExit(sizeof(int) * n);
+    bool *visited = (bool*)allocOrExit(n);
+    DFSFrame *stack = (DFSFrame*)allocOrExit(sizeof(DFSFrame) * n);
+
+    *bfsTime = 0;
+    *dfsTime = 0;
+    *sameDepths = true;
+    for (int r = 0; r < NUM_ROOTS; r++) {
+        int root = oldToNew != NULL ? oldToNew[roots[r]] : roots[r];
+
+        double start = getTimeSeconds();
+        BFS(g, root, depth, queue);
+        *bfsTime += getTimeSeconds() - start;
+
+        start = getTimeSeconds();
+        DFS(g, root, visited, stack);
+        *dfsTime += getTimeSeconds() - start;
+
+        // Report in original ids: depth of original vertex v is depth[oldToNew[v]]
+        if (referenceDepths[r] == NULL) {
+            referenceDepths[r] = (int*)allocOrExit(sizeof(int) * n);
+            memcpy(referenceDepths[r], depth, sizeof(int) * n);
+        } else {
+            for (int i = 0; i < n; i++) {
+                if (referenceDepths[r][newToOld[i]] != depth[i]) {
+                    *sameDepths = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    free(depth);
+    free(queue);
+    free(visited);
+    free(stack);
+}
+
+void runBenchmark(const char *name, CSRGraph *g) {
+    printf("\n%s: %d vertices, %lld adjacency entries\n", name, g->numVertices, g->numEdges);
+    if (g->numEdges == 0) {
+        printf("No non-isolated vertex to use as a root; skipping\n");
+        return;
+    }
+    printf("%-16s %10s %10s %9s %9s %9s %9s %9s %6s\n", "Ordering", "Bandwidth", "Avg gap",
+           "Build s", "BFS ms", "Speedup", "DFS ms", "Speedup", "Same");
+    printf("------------------------------------------------------------------------------------------\n");
+
+    int n = g->numVertices;
+    int roots[NUM_ROOTS];
+    uint64_t state = 404;
+    for (int r = 0; r < NUM_ROOTS; r++) {
+        do {
+            roots[r] = nextRandom(&state) % n;
+        } while (degree(g, roots[r]) == 0);
+    }
+    int *referenceDepths[NUM_ROOTS] = {NULL};
+
+    long long bandwidth;
+    double averageGap, baseBFS, baseDFS;
+    bool same;
+    edgeSpan(g, &bandwidth, &averageGap);
+    timeTraversals(g, roots, NULL, NULL, referenceDepths, &baseBFS, &baseDFS, &same);
+    printf("%-16s %10lld %10.0f %9s %9.1f %8.2fx %9.1f %8.2fx %6s\n", "Original", bandwidth, averageGap,
+           "-", baseBFS / NUM_ROOTS * 1000, 1.0, baseDFS / NUM_ROOTS * 1000, 1.0, "-");
+
+    const char *names[] = {"Degree-desc", "BFS order", "RCM"};
+    OrderFunction functions[] = {orderDegreeDescending, orderBFS, orderRCM};
+    for (int o = 0; o < 3; o++) {
+        Reordering order;
+        order.name = names[o];
+        order.oldToNew = (int*)allocOrExit(sizeof(int) * n);
+        order.newToOld = (int*)allocOrExit(sizeof(int) * n);
+
+        double start = getTimeSeconds();
+        functions[o](g, order.oldToNew);
+        invertOrder(order.oldToNew, order.newToOld, n);
+        CSRGraph *r = relabelGraph(g, order.oldToNew, order.newToOld);
+        order.seconds = getTimeSeconds() - start;
+
+        double bfsTime, dfsTime;
+        edgeSpan(r, &bandwidth, &averageGap);
+        timeTraversals(r, roots, order.oldToNew, order.newToOld, referenceDepths, &bfsTime, &dfsTime, &same);
+        printf("%-16s %10lld %10.0f %9.2f %9.1f %8.2fx %9.1f %8.2fx %6s\n", order.name, bandwidth, averageGap,
+               order.seconds, bfsTime / NUM_ROOTS * 1000, baseBFS / bfsTime,
+               dfsTime / NUM_ROOTS * 1000, baseDFS / dfsTime, same ? "yes" : "NO");
+
+        freeCSR(r);
+        free(order.oldToNew);
+        free(order.newToOld);
+    }
+
+    for (int r = 0; r < NUM_ROOTS; r++) {
+        free(referenceDepths[r]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  VERTEX REORDERING FOR CACHE LOCALITY\n");
+    printf("  RCM, Degree-Sorted and BFS Order\n");
+    printf("=========================================\n\n");
+
+    // Program 5's example graph with its vertex ids scrambled
+    printf("Example: Program 5's grid with scrambled ids\n\n");
+    printf("    4 --- 0 --- 5\n");
+    printf("    |     |     |\n");
+    printf("    2 --- 3 --- 1\n");
+    Edge *demoEdges = (Edge*)allocOrExit(sizeof(Edge) * 7);
+    Edge demo[] = {{4, 0}, {4, 2}, {0, 5}, {0, 3}, {5, 1}, {2, 3}, {3, 1}};
+    memcpy(demoEdges, demo, sizeof(demo));
+    CSRGraph *g = buildCSR(6, demoEdges, 7);
+
+    int oldToNew[6], newToOld[6], depth[6], queue[6];
+    orderRCM(g, oldToNew);
+    invertOrder(oldToNew, newToOld, 6);
+    CSRGraph *r = relabelGraph(g, oldToNew, newToOld);
+
+    long long bandwidth;
+    double averageGap;
+    edgeSpan(g, &bandwidth, &averageGap);
+    printf("\nOriginal bandwidth %lld, average gap %.2f\n", bandwidth, averageGap);
+    edgeSpan(r, &bandwidth, &averageGap);
+    printf("RCM bandwidth %lld, average gap %.2f\n", bandwidth, averageGap);
+    printf("\nold -> new:");
+    for (int v = 0; v < 6; v++) {
+        printf("  %d->%d", v, oldToNew[v]);
+    }
+
+    // Traverse the relabeled graph, report in original ids
+    BFS(r, oldToNew[4], depth, queue);
+    printf("\n\nBFS from original vertex 4 on the RCM graph, reported in original ids:\n");
+    for (int i = 0; i < 6; i++) {
+        printf("%d ", newToOld[queue[i]]);
+    }
+    printf("\n");
+    for (int v = 0; v < 6; v++) {
+        printf("  vertex %d: depth %d\n", v, depth[oldToNew[v]]);
+    }
+    freeCSR(r);
+    freeCSR(g);
+
+    int side = 2048;
+    int scale = 21;
+    if (argc > 1) {
+        side = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        scale = atoi(argv[2]);
+    }
+    if (side < 2 || scale < 2 || scale > 26) {
+        printf("Usage: %s [gridSide] [rmatScale 2-26]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (%d roots per ordering):\n", NUM_ROOTS);
+    printf("-------------------------------------------");
+
+    long long numEdges;
+    Edge *edges = scrambledGridEdges(side, side, &numEdges, 17);
+    g = buildCSR(side * side, edges, numEdges);
+    char name[64];
+    snprintf(name, sizeof(name), "Scrambled %dx%d grid", side, side);
+    runBenchmark(name, g);
+    freeCSR(g);
+
+    numEdges = 16LL << scale;
+    edges = scrambledRMATEdges(scale, numEdges, 23);
+    g = buildCSR(1 << scale, edges, numEdges);
+    snprintf(name, sizeof(name), "Scrambled R-MAT scale %d", scale);
+    runBenchmark(name, g);
+    freeCSR(g);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,626 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// One bit per concurrent search; a batch uses 1 to 4 64-bit words per vertex
+#define WORD_BITS 64
+#define MAX_WORDS 4
+#define MAX_SOURCES (WORD_BITS * MAX_WORDS)
+
+// Scan all vertices instead of the frontier list above n / SCAN_DIVISOR
+#define SCAN_DIVISOR 16
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Undirected graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// Per-source results of a batch of searches
+typedef struct {
+    int numSources;
+    long long *distanceSums;  // Sum of distances to reached vertices
+    int *reached;             // Vertices reached, including the source
+    int *eccentricity;        // Largest distance reached
+} SourceStats;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// Function to allocate zeroed 32-byte aligned words (for AVX2 loads)
+uint64_t* allocWords(size_t count) {
+    size_t bytes = (count * sizeof(uint64_t) + 31) & ~(size_t)31;
+    uint64_t *words = (uint64_t*)aligned_alloc(32, bytes > 0 ? bytes : 32);
+    if (words == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    memset(words, 0, bytes);
+    return words;
+}
+
+// ==================== CSR ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to build an undirected CSR graph with sorted, duplicate-free
+// neighbor lists and no self loops; frees the edge list
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        if (edges[e].src != edges[e].dest) {
+            offsets[edges[e].src + 1]++;
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u != v) {
+            neighbors[cursor[u]++] = v;
+            neighbors[cursor[v]++] = u;
+        }
+    }
+    free(edges);
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        qsort(neighbors + start, end - start, sizeof(int), compareInts);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+static inline long long degree(CSRGraph *g, int v) {
+    return g->rowOffsets[v + 1] - g->rowOffsets[v];
+}
+
+// R-MAT generator with Graph500 parameters and scrambled ids (see Program 22)
+CSRGraph* generateRMAT(int scale, int edgeFactor, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    int n = 1 << scale;
+    long long m = (long long)edgeFactor * n;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * m);
+    int *permutation = (int*)allocOrExit(sizeof(int) * n);
+    uint64_t state = seed;
+
+    for (int v = 0; v < n; v++) {
+        permutation[v] = v;
+    }
+    for (int v = n - 1; v > 0; v--) {
+        int j = nextRandom(&state) % (v + 1);
+        int t = permutation[v];
+        permutation[v] = permutation[j];
+        permutation[j] = t;
+    }
+
+    for (long long e = 0; e < m; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0);
+            if (r >= a && r < a + b) {
+                v |= 1 << bit;
+            } else if (r >= a + b && r < a + b + c) {
+                u |= 1 << bit;
+            } else if (r >= a + b + c) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = permutation[u];
+        edges[e].dest = permutation[v];
+    }
+
+    free(permutation);
+    return buildCSR(n, edges, m);
+}
+
+// 2D grid (rows x cols, 4-neighbor) written straight into CSR (see Program 22)
+CSRGraph* generateGrid(int rows, int cols) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    int n = rows * cols;
+    g->numVertices = n;
+    g->rowOffsets = (long long*)allocOrExit(sizeof(long long) * (n + 1));
+    g->numEdges = 2LL * ((long long)rows * (cols - 1) + (long long)(rows - 1) * cols);
+    g->neighbors = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+
+    long long pos = 0;
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int v = r * cols + c;
+            g->rowOffsets[v] = pos;
+            if (r > 0) {
+                g->neighbors[pos++] = v - cols;
+            }
+            if (c > 0) {
+                g->neighbors[pos++] = v - 1;
+            }
+            if (c + 1 < cols) {
+                g->neighbors[pos++] = v + 1;
+            }
+            if (r + 1 < rows) {
+                g->neighbors[pos++] = v + cols;
+            }
+        }
+    }
+    g->rowOffsets[n] = pos;
+    return g;
+}
+
+// ==================== SOURCE STATS ====================
+
+SourceStats* createSourceStats(int numSources) {
+    SourceStats *stats = (SourceStats*)allocOrExit(sizeof(SourceStats));
+    stats->numSources = numSources;
+    stats->distanceSums = (long long*)calloc(numSources, sizeof(long long));
+    stats->reached = (int*)calloc(numSources, sizeof(int));
+    stats->eccentricity = (int*)calloc(numSources, sizeof(int));
+    if (stats->distanceSums == NULL || stats->reached == NULL || stats->eccentricity == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return stats;
+}
+
+void freeSourceStats(SourceStats *stats) {
+    free(stats->distanceSums);
+    free(stats->reached);
+    free(stats->eccentricity);
+    free(stats);
+}
+
+bool sameStats(SourceStats *a, SourceStats *b) {
+    for (int i = 0; i < a->numSources; i++) {
+        if (a->distanceSums[i] != b->distanceSums[i] || a->reached[i] != b->reached[i] ||
+            a->eccentricity[i] != b->eccentricity[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Closeness centrality (Wasserman-Faust form, valid for disconnected graphs)
+double closeness(SourceStats *stats, int source, int numVertices) {
+    if (stats->distanceSums[source] == 0) {
+        return 0.0;
+    }
+    double reachable = stats->reached[source] - 1;
+    return (reachable / (numVertices - 1)) * (reachable / stats->distanceSums[source]);
+}
+
+// ==================== SINGLE-SOURCE BFS ====================
+
+// BFS from one source (as in Program 15); writes distances (-1 if
+// unreached) and fills the source's entry in stats
+void BFS(CSRGraph *g, int source, int *distance, int *queue, SourceStats *stats, int index) {
+    for (int v = 0; v < g->numVertices; v++) {
+        distance[v] = -1;
+    }
+    int head = 0;
+    int tail = 0;
+    long long sum = 0;
+    distance[source] = 0;
+    queue[tail++] = source;
+    while (head < tail) {
+        int u = queue[head++];
+        sum += distance[u];
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            if (distance[v] < 0) {
+                distance[v] = distance[u] + 1;
+                queue[tail++] = v;
+            }
+        }
+    }
+    stats->distanceSums[index] = sum;
+    stats->reached[index] = tail;
+    stats->eccentricity[index] = distance[queue[tail - 1]];
+}
+
+// ==================== MULTI-SOURCE BFS ====================
+
+// Function to push the searches in 'from' into a neighbor: fresh = from &
+// ~seen, then seen |= fresh and next |= fresh. Returns whether any search
+// reached the neighbor for the first time.
+static inline bool propagate(const uint64_t *from, uint64_t *seen, uint64_t *next,
+                             uint64_t *fresh, int words) {
+#ifdef __AVX2__
+    if (words == 4) {
+        __m256i f = _mm256_load_si256((const __m256i*)from);
+        __m256i s = _mm256_load_si256((const __m256i*)seen);
+        __m256i d = _mm256_andnot_si256(s, f);
+        if (_mm256_testz_si256(d, d)) {
+            return false;
+        }
+        _mm256_store_si256((__m256i*)seen, _mm256_or_si256(s, d));
+        _mm256_store_si256((__m256i*)next, _mm256_or_si256(_mm256_load_si256((const __m256i*)next), d));
+        _mm256_store_si256((__m256i*)fresh, d);
+        return true;
+    }
+#endif
+    uint64_t any = 0;
+    for (int w = 0; w < words; w++) {
+        fresh[w] = from[w] & ~seen[w];
+        any |= fresh[w];
+    }
+    if (any == 0) {
+        return false;
+    }
+    for (int w = 0; w < words; w++) {
+        seen[w] |= fresh[w];
+        next[w] |= fresh[w];
+    }
+    return true;
+}
+
+static inline bool isEmpty(const uint64_t *mask, int words) {
+    uint64_t any = 0;
+    for (int w = 0; w < words; w++) {
+        any |= mask[w];
+    }
+    return any == 0;
+}
+
+// Function to record distance 'level' for every search in 'fresh' reaching v
+static inline void recordLevel(const uint64_t *fresh, int words, int v, int level, int firstSource,
+                               int *distances, int numVertices, SourceStats *stats) {
+    for (int w = 0; w < words; w++) {
+        uint64_t bits = fresh[w];
+        while (bits != 0) {
+            int s = firstSource + w * WORD_BITS + __builtin_ctzll(bits);
+            stats->distanceSums[s] += level;
+            stats->reached[s]++;
+            stats->eccentricity[s] = level;
+            if (distances != NULL) {
+                distances[(long long)(s - firstSource) * numVertices + v] = level;
+            }
+            bits &= bits - 1;
+        }
+    }
+}
+
+// Multi-source BFS: runs numSources (<= 256) searches together. Each vertex
+// holds one bit per search in 'seen' (searches that reached it) and 'visit'
+// (searches at it in the current level). One sweep over the frontier's
+// edges advances every search by one level, so a vertex or edge shared by
+// many searches is loaded once instead of once per search.
+// distances (numSources x numVertices, -1 if unreached) may be NULL; stats
+// entries firstSource .. firstSource + numSources - 1 are filled.
+// Returns the number of levels, or -1 if numSources is out of range.
+int multiSourceBFS(CSRGraph *g, const int *sources, int numSources, int *distances,
+                   SourceStats *stats, int firstSource) {
+    if (numSources < 1 || numSources > MAX_SOURCES) {
+        return -1;
+    }
+    int n = g->numVertices;
+    int words = (numSources + WORD_BITS - 1) / WORD_BITS;
+    uint64_t *seen = allocWords((size_t)n * words);
+    uint64_t *visit = allocWords((size_t)n * words);
+    uint64_t *next = allocWords((size_t)n * words);
+    uint64_t *fresh = allocWords(MAX_WORDS);
+    int *frontier = (int*)allocOrExit(sizeof(int) * n);
+    int *nextFrontier = (int*)allocOrExit(sizeof(int) * n);
+    int frontierSize = 0;
+
+    if (distances != NULL) {
+        for (long long i = 0; i < (long long)numSources * n; i++) {
+            distances[i] = -1;
+        }
+    }
+
+    // Level 0: each search starts at its source (sources may repeat)
+    for (int i = 0; i < numSources; i++) {
+        int s = sources[i];
+        uint64_t bit = 1ULL << (i % WORD_BITS);
+        if (isEmpty(visit + (size_t)s * words, words)) {
+            frontier[frontierSize++] = s;
+        }
+        seen[(size_t)s * words + i / WORD_BITS] |= bit;
+        visit[(size_t)s * words + i / WORD_BITS] |= bit;
+        stats->reached[firstSource + i] = 1;
+        stats->distanceSums[firstSource + i] = 0;
+        stats->eccentricity[firstSource + i] = 0;
+        if (distances != NULL) {
+            distances[(long long)i * n + s] = 0;
+        }
+    }
+
+    int level = 0;
+    while (frontierSize > 0) {
+        level++;
+        int nextSize = 0;
+        // A large frontier is walked by scanning all vertices in id order,
+        // which touches the masks sequentially; a small one from its list
+        bool scan = (long long)frontierSize * SCAN_DIVISOR > n;
+        for (int i = 0; i < (scan ? n : frontierSize); i++) {
+            int u = scan ? i : frontier[i];
+            const uint64_t *from = visit + (size_t)u * words;
+            if (scan && isEmpty(from, words)) {
+                continue;
+            }
+            for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+                int v = g->neighbors[k];
+                uint64_t *target = next + (size_t)v * words;
+                bool wasEmpty = isEmpty(target, words);
+                if (propagate(from, seen + (size_t)v * words, target, fresh, words)) {
+                    if (wasEmpty) {
+                        nextFrontier[nextSize++] = v;
+                    }
+                    recordLevel(fresh, words, v, level, firstSource, distances, n, stats);
+                }
+            }
+        }
+
+        // Clear the finished level's masks, then swap levels
+        for (int i = 0; i < frontierSize; i++) {
+            memset(visit + (size_t)frontier[i] * words, 0, sizeof(uint64_t) * words);
+        }
+        uint64_t *maskSwap = visit;
+        visit = next;
+        next = maskSwap;
+        int *listSwap = frontier;
+        frontier = nextFrontier;
+        nextFrontier = listSwap;
+        frontierSize = nextSize;
+    }
+
+    free(seen);
+    free(visit);
+    free(next);
+    free(fresh);
+    free(frontier);
+    free(nextFrontier);
+    return level - 1;
+}
+
+// Function to run any number of sources in batches of batchSize
+void multiSourceBFSAll(CSRGraph *g, const int *sources, int numSources, int batchSize, SourceStats *stats) {
+    for (int first = 0; first < numSources; first += batchSize) {
+        int count = numSources - first < batchSize ? numSources - first : batchSize;
+        multiSourceBFS(g, sources + first, count, NULL, stats, first);
+    }
+}
+
+// ==================== BENCHMARK ====================
+
+// Function to pick sources: random non-isolated vertices, or (clustered)
+// the first vertices a BFS from a random vertex reaches, as when ranking
+// the vertices of one neighborhood
+void pickSources(CSRGraph *g, int *sources, int numSources, bool clustered, int *distance, int *queue) {
+    int n = g->numVertices;
+    uint64_t state = 99;
+    int count = 0;
+    if (clustered) {
+        int root;
+        do {
+            root = nextRandom(&state) % n;
+        } while (degree(g, root) == 0);
+        SourceStats *stats = createSourceStats(1);
+        BFS(g, root, distance, queue, stats, 0);
+        count = stats->reached[0] < numSources ? stats->reached[0] : numSources;
+        memcpy(sources, queue, sizeof(int) * count);
+        freeSourceStats(stats);
+    }
+    for (int i = count; i < numSources; i++) {
+        do {
+            sources[i] = nextRandom(&state) % n;
+        } while (degree(g, sources[i]) == 0);
+    }
+}
+
+void runBenchmark(const char *name, CSRGraph *g, int numSources, bool clustered) {
+    int n = g->numVertices;
+    printf("\n%s: %d vertices, %lld adjacency entries, %d %s sources\n", name, n, g->numEdges,
+           numSources, clustered ? "clustered" : "random");
+    if (g->numEdges == 0) {
+        printf("No non-isolated vertex to use as a root; skipping\n");
+        return;
+    }
+    printf("%-22s %10s %12s %9s %6s\n", "Method", "Total ms", "ms/source", "Speedup", "Same");
+    printf("-------------------------------------------------------------\n");
+
+    int *sources = (int*)allocOrExit(sizeof(int) * numSources);
+    int *distance = (int*)allocOrExit(sizeof(int) * n);
+    int *queue = (int*)allocOrExit(sizeof(int) * n);
+    pickSources(g, sources, numSources, clustered, distance, queue);
+
+    // Baseline: one BFS per source
+    SourceStats *reference = createSourceStats(numSources);
+    double start = getTimeSeconds();
+    for (int i = 0; i < numSources; i++) {
+        BFS(g, sources[i], distance, queue, reference, i);
+    }
+    double baseline = getTimeSeconds() - start;
+    printf("%-22s %10.1f %12.3f %8.2fx %6s\n", "BFS loop", baseline * 1000,
+           baseline * 1000 / numSources, 1.0, "-");
+
+    int widths[] = {64, 128, 256};
+    for (int i = 0; i < 3; i++) {
+        SourceStats *stats = createSourceStats(numSources);
+        start = getTimeSeconds();
+        multiSourceBFSAll(g, sources, numSources, widths[i], stats);
+        double elapsed = getTimeSeconds() - start;
+        char label[32];
+        snprintf(label, sizeof(label), "Multi-source x%d", widths[i]);
+        printf("%-22s %10.1f %12.3f %8.2fx %6s\n", label, elapsed * 1000, elapsed * 1000 / numSources,
+               baseline / elapsed, sameStats(reference, stats) ? "yes" : "NO");
+        freeSourceStats(stats);
+    }
+
+    // Full per-source distances for one batch of 64, checked vertex by vertex
+    int batch = numSources < WORD_BITS ? numSources : WORD_BITS;
+    int *distances = (int*)allocOrExit(sizeof(int) * (size_t)batch * n);
+    SourceStats *stats = createSourceStats(batch);
+    multiSourceBFS(g, sources, batch, distances, stats, 0);
+    bool same = true;
+    for (int i = 0; i < batch && same; i++) {
+        BFS(g, sources[i], distance, queue, reference, i);
+        same = memcmp(distance, distances + (size_t)i * n, sizeof(int) * n) == 0;
+    }
+    printf("Distance arrays for %d sources identical to BFS: %s\n", batch, same ? "yes" : "NO");
+
+    int best = 0;
+    for (int i = 1; i < numSources; i++) {
+        if (closeness(reference, i, n) > closeness(reference, best, n)) {
+            best = i;
+        }
+    }
+    printf("Most central source: vertex %d (closeness %.4f, eccentricity %d)\n",
+           sources[best], closeness(reference, best, n), reference->eccentricity[best]);
+
+    freeSourceStats(stats);
+    freeSourceStats(reference);
+    free(distances);
+    free(distance);
+    free(queue);
+    free(sources);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  BIT-PARALLEL MULTI-SOURCE BFS\n");
+    printf("  Up to 256 Searches per Sweep\n");
+    printf("=========================================\n\n");
+
+    // Program 5's example graph, BFS from every vertex in one sweep
+    printf("Example: all-pairs distances on Program 5's graph\n\n");
+    printf("    0 --- 1 --- 2\n");
+    printf("    |     |     |\n");
+    printf("    3 --- 4 --- 5\n\n");
+    Edge demo[] = {{0, 1}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {4, 5}};
+    Edge *demoEdges = (Edge*)allocOrExit(sizeof(demo));
+    memcpy(demoEdges, demo, sizeof(demo));
+    CSRGraph *g = buildCSR(6, demoEdges, 7);
+
+    int allSources[6] = {0, 1, 2, 3, 4, 5};
+    int allDistances[36];
+    SourceStats *demoStats = createSourceStats(6);
+    int levels = multiSourceBFS(g, allSources, 6, allDistances, demoStats, 0);
+    printf("6 searches finished in %d levels (one sweep per level)\n\n", levels);
+    printf("From\\To ");
+    for (int v = 0; v < 6; v++) {
+        printf("%3d", v);
+    }
+    printf("   Closeness\n");
+    for (int s = 0; s < 6; s++) {
+        printf("%7d ", s);
+        for (int v = 0; v < 6; v++) {
+            printf("%3d", allDistances[s * 6 + v]);
+        }
+        printf("   %.3f\n", closeness(demoStats, s, 6));
+    }
+    freeSourceStats(demoStats);
+    freeCSR(g);
+
+    int scale = 18;
+    int numSources = 256;
+    if (argc > 1) {
+        scale = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        numSources = atoi(argv[2]);
+    }
+    if (scale < 4 || scale > 26 || numSources < 1) {
+        printf("Usage: %s [scale 4-26] [numSources]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (closeness for many sources):\n");
+    printf("-------------------------------------------\n");
+#ifdef __AVX2__
+    printf("256-wide masks: AVX2\n");
+#else
+    printf("256-wide masks: scalar words (compile with -mavx2 for AVX2)\n");
+#endif
+
+    char name[64];
+    g = generateRMAT(scale, 16, 7);
+    snprintf(name, sizeof(name), "R-MAT scale %d", scale);
+    runBenchmark(name, g, numSources, false);
+    freeCSR(g);
+
+    int side = 1 << (scale / 2);
+    g = generateGrid(side, side);
+    snprintf(name, sizeof(name), "%dx%d grid", side, side);
+    runBenchmark(name, g, numSources, false);
+    runBenchmark(name, g, numSources, true);
+    freeCSR(g);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
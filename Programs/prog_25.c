@@ -0,0 +1,422 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define INITIAL_LIST_CAPACITY 4
+#define TIMING_BATCH 4096      // Fewest edges worth a pair of clock reads
+#define MAX_PAIRS 64
+
+// Union-find over vertex ids; grows with the graph
+typedef struct {
+    int *parent;
+    int *size;                // Component size, valid at roots
+    int count;                // Number of elements
+    int capacity;
+    int numComponents;
+    int largest;              // Size of the largest component
+} UnionFind;
+
+// Adjacency list of one vertex (growable array)
+typedef struct {
+    int *items;
+    int count;
+    int capacity;
+} AdjList;
+
+// Undirected graph that keeps its connectivity up to date as edges arrive
+typedef struct {
+    int numVertices;
+    int capacity;
+    long long numEdges;
+    AdjList *adj;
+    UnionFind components;
+} DynamicGraph;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+void* reallocOrExit(void *memory, size_t bytes) {
+    void *grown = realloc(memory, bytes);
+    if (grown == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return grown;
+}
+
+// ==================== UNION-FIND ====================
+
+void initUnionFind(UnionFind *uf, int capacity) {
+    uf->capacity = capacity > 0 ? capacity : 1;
+    uf->parent = (int*)allocOrExit(sizeof(int) * uf->capacity);
+    uf->size = (int*)allocOrExit(sizeof(int) * uf->capacity);
+    uf->count = 0;
+    uf->numComponents = 0;
+    uf->largest = 0;
+}
+
+void freeUnionFind(UnionFind *uf) {
+    free(uf->parent);
+    free(uf->size);
+}
+
+// Function to add a singleton set; returns its id
+int ufAdd(UnionFind *uf) {
+    if (uf->count == uf->capacity) {
+        uf->capacity *= 2;
+        uf->parent = (int*)reallocOrExit(uf->parent, sizeof(int) * uf->capacity);
+        uf->size = (int*)reallocOrExit(uf->size, sizeof(int) * uf->capacity);
+    }
+    int id = uf->count++;
+    uf->parent[id] = id;
+    uf->size[id] = 1;
+    uf->numComponents++;
+    if (uf->largest < 1) {
+        uf->largest = 1;
+    }
+    return id;
+}
+
+// Find with path halving: every other node on the path is pointed at its
+// grandparent, which keeps trees flat without a second pass
+static inline int ufFind(UnionFind *uf, int x) {
+    while (uf->parent[x] != x) {
+        uf->parent[x] = uf->parent[uf->parent[x]];
+        x = uf->parent[x];
+    }
+    return x;
+}
+
+// Union by size; returns true if two components were merged. With path
+// halving, each operation costs O(alpha(n)) amortized.
+bool ufUnion(UnionFind *uf, int a, int b) {
+    int rootA = ufFind(uf, a);
+    int rootB = ufFind(uf, b);
+    if (rootA == rootB) {
+        return false;
+    }
+    if (uf->size[rootA] < uf->size[rootB]) {
+        int t = rootA;
+        rootA = rootB;
+        rootB = t;
+    }
+    uf->parent[rootB] = rootA;
+    uf->size[rootA] += uf->size[rootB];
+    uf->numComponents--;
+    if (uf->size[rootA] > uf->largest) {
+        uf->largest = uf->size[rootA];
+    }
+    return true;
+}
+
+// ==================== DYNAMIC GRAPH ====================
+
+// Function to add an isolated vertex (a new component); returns its id
+int addVertex(DynamicGraph *g) {
+    if (g->numVertices == g->capacity) {
+        g->capacity *= 2;
+        g->adj = (AdjList*)reallocOrExit(g->adj, sizeof(AdjList) * g->capacity);
+    }
+    AdjList *list = &g->adj[g->numVertices];
+    list->items = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    ufAdd(&g->components);
+    return g->numVertices++;
+}
+
+static void appendNeighbor(AdjList *list, int v) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity > 0 ? list->capacity * 2 : INITIAL_LIST_CAPACITY;
+        list->items = (int*)reallocOrExit(list->items, sizeof(int) * list->capacity);
+    }
+    list->items[list->count++] = v;
+}
+
+DynamicGraph* createDynamicGraph(int numVertices) {
+    DynamicGraph *g = (DynamicGraph*)allocOrExit(sizeof(DynamicGraph));
+    g->numVertices = 0;
+    g->capacity = numVertices > 0 ? numVertices : 1;
+    g->numEdges = 0;
+    g->adj = (AdjList*)allocOrExit(sizeof(AdjList) * g->capacity);
+    initUnionFind(&g->components, g->capacity);
+    for (int i = 0; i < numVertices; i++) {
+        addVertex(g);
+    }
+    return g;
+}
+
+void freeDynamicGraph(DynamicGraph *g) {
+    for (int v = 0; v < g->numVertices; v++) {
+        free(g->adj[v].items);
+    }
+    free(g->adj);
+    freeUnionFind(&g->components);
+    free(g);
+}
+
+// Add edge to undirected graph and merge the endpoints' components.
+// Returns true if the edge joined two components.
+bool addEdge(DynamicGraph *g, int src, int dest) {
+    if (src >= g->numVertices || dest >= g->numVertices || src < 0 || dest < 0) {
+        printf("Invalid vertices!\n");
+        return false;
+    }
+    appendNeighbor(&g->adj[src], dest);
+    if (src != dest) {
+        appendNeighbor(&g->adj[dest], src);
+    }
+    g->numEdges++;
+    return ufUnion(&g->components, src, dest);
+}
+
+// ==================== QUERIES ====================
+
+// O(1): the component count is maintained by addEdge/addVertex
+bool isConnected(DynamicGraph *g) {
+    return g->components.numComponents <= 1;
+}
+
+int countComponents(DynamicGraph *g) {
+    return g->components.numComponents;
+}
+
+// Near O(1): two finds on flat trees
+bool sameComponent(DynamicGraph *g, int u, int v) {
+    return ufFind(&g->components, u) == ufFind(&g->components, v);
+}
+
+int componentSize(DynamicGraph *g, int v) {
+    return g->components.size[ufFind(&g->components, v)];
+}
+
+int largestComponent(DynamicGraph *g) {
+    return g->components.largest;
+}
+
+// ==================== TRAVERSAL BASELINE ====================
+
+// Function to BFS from start, marking 'label' in component[]; returns the
+// number of vertices reached
+static int labelFrom(DynamicGraph *g, int start, int label, int *component, int *queue) {
+    int head = 0;
+    int tail = 0;
+    component[start] = label;
+    queue[tail++] = start;
+    while (head < tail) {
+        AdjList *list = &g->adj[queue[head++]];
+        for (int i = 0; i < list->count; i++) {
+            int v = list->items[i];
+            if (component[v] < 0) {
+                component[v] = label;
+                queue[tail++] = v;
+            }
+        }
+    }
+    return tail;
+}
+
+// Traversal versions, as Program 5 answers these questions: O(V + E) each
+bool isConnectedTraversal(DynamicGraph *g, int *component, int *queue) {
+    for (int v = 0; v < g->numVertices; v++) {
+        component[v] = -1;
+    }
+    return g->numVertices == 0 || labelFrom(g, 0, 0, component, queue) == g->numVertices;
+}
+
+int countComponentsTraversal(DynamicGraph *g, int *component, int *queue) {
+    int count = 0;
+    for (int v = 0; v < g->numVertices; v++) {
+        component[v] = -1;
+    }
+    for (int v = 0; v < g->numVertices; v++) {
+        if (component[v] < 0) {
+            labelFrom(g, v, count++, component, queue);
+        }
+    }
+    return count;
+}
+
+bool sameComponentTraversal(DynamicGraph *g, int u, int v, int *component, int *queue) {
+    for (int i = 0; i < g->numVertices; i++) {
+        component[i] = -1;
+    }
+    labelFrom(g, u, 0, component, queue);
+    return component[v] == 0;
+}
+
+// ==================== BENCHMARK ====================
+
+// Function to stream random edges into an empty graph until it is
+// connected, answering connectivity queries every 'checkEvery' edges, with
+// union-find queries and (optionally) traversal queries. A clock read costs
+// about as much as a query, so ingest and queries are timed per checkpoint
+// only when a checkpoint holds at least TIMING_BATCH edges. Otherwise the
+// whole stream is timed once, the same edges are replayed with no queries to
+// time the ingest alone, and the queries get the difference.
+void runStream(int numVertices, int checkEvery, int pairsPerCheck, bool compareTraversal) {
+    DynamicGraph *g = createDynamicGraph(numVertices);
+    int *component = (int*)allocOrExit(sizeof(int) * numVertices);
+    int *queue = (int*)allocOrExit(sizeof(int) * numVertices);
+    uint64_t edgeState = 2024;
+    uint64_t queryState = 4048;
+    bool timePhases = checkEvery >= TIMING_BATCH;
+    double ingestTime = 0;
+    double queryTime = 0;
+    double traversalTime = 0;
+    long long checks = 0;
+    long long queries = 0;
+    long long giantAt = -1;
+    bool agree = true;
+
+    printf("\n%d vertices, queries every %d edge%s%s\n", numVertices, checkEvery, checkEvery == 1 ? "" : "s",
+           compareTraversal ? " (union-find vs traversal)" : " (union-find only)");
+
+    double streamStart = getTimeSeconds();
+    while (!isConnected(g)) {
+        double start = timePhases ? getTimeSeconds() : 0;
+        for (int i = 0; i < checkEvery; i++) {
+            addEdge(g, nextRandom(&edgeState) % numVertices, nextRandom(&edgeState) % numVertices);
+        }
+        if (timePhases) {
+            ingestTime += getTimeSeconds() - start;
+        }
+
+        // The same questions, answered both ways
+        int pairs[2 * MAX_PAIRS];
+        for (int q = 0; q < 2 * pairsPerCheck; q++) {
+            pairs[q] = nextRandom(&queryState) % numVertices;
+        }
+        bool same[MAX_PAIRS];
+        start = timePhases ? getTimeSeconds() : 0;
+        bool connected = isConnected(g);
+        int count = countComponents(g);
+        for (int q = 0; q < pairsPerCheck; q++) {
+            same[q] = sameComponent(g, pairs[2 * q], pairs[2 * q + 1]);
+        }
+        if (timePhases) {
+            queryTime += getTimeSeconds() - start;
+        }
+        queries += 2 + pairsPerCheck;
+        checks++;
+
+        if (giantAt < 0 && largestComponent(g) * 2 > numVertices) {
+            giantAt = g->numEdges;
+        }
+
+        if (compareTraversal) {
+            start = getTimeSeconds();
+            agree &= isConnectedTraversal(g, component, queue) == connected;
+            agree &= countComponentsTraversal(g, component, queue) == count;
+            for (int q = 0; q < pairsPerCheck; q++) {
+                agree &= sameComponentTraversal(g, pairs[2 * q], pairs[2 * q + 1], component, queue) == same[q];
+            }
+            traversalTime += getTimeSeconds() - start;
+        }
+    }
+    double streamTime = getTimeSeconds() - streamStart - traversalTime;
+
+    if (!timePhases) {
+        DynamicGraph *replay = createDynamicGraph(numVertices);
+        edgeState = 2024;
+        double start = getTimeSeconds();
+        for (long long e = 0; e < g->numEdges; e++) {
+            addEdge(replay, nextRandom(&edgeState) % numVertices, nextRandom(&edgeState) % numVertices);
+        }
+        ingestTime = getTimeSeconds() - start;
+        queryTime = streamTime > ingestTime ? streamTime - ingestTime : 0;
+        freeDynamicGraph(replay);
+    }
+
+    double theory = 0.5 * numVertices * log((double)numVertices);
+    printf("Giant component (> n/2) after %lld edges; connected after %lld edges (n ln n / 2 = %.0f)\n",
+           giantAt, g->numEdges, theory);
+    printf("  addEdge with union-find:  %8.1f ns/edge\n", ingestTime / g->numEdges * 1e9);
+    printf("  Union-find queries:       %8.1f ns/query  (%lld queries at %lld checkpoints)\n",
+           queryTime / queries * 1e9, queries, checks);
+    if (compareTraversal) {
+        printf("  Traversal queries:        %8.1f ns/query  (%.0fx slower)\n",
+               traversalTime / queries * 1e9, traversalTime / queryTime);
+        printf("  Answers agree: %s\n", agree ? "yes" : "NO");
+    }
+
+    free(component);
+    free(queue);
+    freeDynamicGraph(g);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  INCREMENTAL CONNECTIVITY\n");
+    printf("  Union-Find Maintained by addEdge\n");
+    printf("=========================================\n\n");
+
+    // Program 5's example graph, built one edge at a time
+    printf("Building Program 5's example graph edge by edge:\n\n");
+    printf("    0 --- 1 --- 2\n");
+    printf("    |     |     |\n");
+    printf("    3 --- 4 --- 5\n\n");
+    DynamicGraph *g = createDynamicGraph(6);
+    int demo[][2] = {{0, 1}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {4, 5}};
+    printf("Start: %d components, connected: %s\n", countComponents(g), isConnected(g) ? "yes" : "no");
+    for (int i = 0; i < 7; i++) {
+        bool merged = addEdge(g, demo[i][0], demo[i][1]);
+        printf("addEdge(%d, %d): %-15s components: %d, connected: %-3s, same(0, 5): %s\n",
+               demo[i][0], demo[i][1], merged ? "merged" : "already joined", countComponents(g),
+               isConnected(g) ? "yes" : "no", sameComponent(g, 0, 5) ? "yes" : "no");
+    }
+
+    int v = addVertex(g);
+    printf("addVertex() -> %d:  components: %d, size of 0's component: %d\n",
+           v, countComponents(g), componentSize(g, 0));
+    printf("addEdge(9, 0): ");
+    addEdge(g, 9, 0);
+    freeDynamicGraph(g);
+
+    int smallVertices = 50000;
+    int largeVertices = 1000000;
+    if (argc > 1) {
+        smallVertices = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        largeVertices = atoi(argv[2]);
+    }
+    if (smallVertices < 2 || largeVertices < 2) {
+        printf("Usage: %s [traversalVertices] [streamVertices]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Streaming Random Edges:\n");
+    printf("-------------------------------------------");
+    runStream(smallVertices, 5000, MAX_PAIRS, true);
+    runStream(largeVertices, 1, 1, false);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,758 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#ifdef __SSSE3__
+#include <immintrin.h>
+#endif
+
+#define NUM_ROOTS 4
+
+// Slack after the encoded bytes so group decoding may load 16 bytes at once
+#define DECODE_PADDING 16
+
+// Edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+} Edge;
+
+// Undirected graph in compressed sparse row form (see Program 15)
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+} CSRGraph;
+
+// Neighbor list encodings
+typedef enum {
+    ENC_VARINT,               // LEB128: 7 bits per byte, high bit = more bytes
+    ENC_GROUP_VARINT          // Groups of 4: one control byte of 2-bit lengths
+} Encoding;
+
+// Graph whose neighbor lists are stored as compressed byte strings. Each
+// list is: degree (varint), then the sorted neighbors as gaps. The first
+// gap is relative to the vertex itself (zigzag, since it may be negative),
+// later gaps are neighbor[i] - neighbor[i - 1] - 1.
+typedef struct {
+    int numVertices;
+    long long numEdges;
+    Encoding encoding;
+    long long *byteOffsets;   // numVertices + 1 entries
+    uint8_t *bytes;           // numBytes + DECODE_PADDING
+    long long numBytes;
+} CompressedGraph;
+
+// Position inside one compressed neighbor list
+typedef struct {
+    const uint8_t *p;
+    int remaining;            // Neighbors not yet returned
+    int previous;             // Last neighbor returned
+    bool first;
+    int index;                // Next value in group[] (group varint)
+    int buffered;             // Values decoded into group[]
+    uint32_t group[4];
+} NeighborCursor;
+
+// DFS stack frame over a compressed list
+typedef struct {
+    int vertex;
+    NeighborCursor cursor;
+} CompressedFrame;
+
+// DFS stack frame over a CSR row (see Program 19)
+typedef struct {
+    int vertex;
+    long long cursor;
+} DFSFrame;
+
+// Group varint decode tables: total bytes and a pshufb mask per control byte
+static uint8_t groupLength[256];
+static uint8_t groupShuffle[256][16];
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== CSR ====================
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Function to build an undirected CSR graph with sorted, duplicate-free
+// neighbor lists and no self loops; frees the edge list
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    long long *offsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    if (offsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        if (edges[e].src != edges[e].dest) {
+            offsets[edges[e].src + 1]++;
+            offsets[edges[e].dest + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int *neighbors = (int*)allocOrExit(sizeof(int) * (offsets[numVertices] + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    memcpy(cursor, offsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        int u = edges[e].src;
+        int v = edges[e].dest;
+        if (u != v) {
+            neighbors[cursor[u]++] = v;
+            neighbors[cursor[v]++] = u;
+        }
+    }
+    free(edges);
+
+    // Sort each row and drop duplicates, compacting in place
+    long long write = 0;
+    for (int v = 0; v < numVertices; v++) {
+        long long start = offsets[v];
+        long long end = offsets[v + 1];
+        qsort(neighbors + start, end - start, sizeof(int), compareInts);
+        cursor[v] = write;
+        for (long long i = start; i < end; i++) {
+            if (i == start || neighbors[i] != neighbors[i - 1]) {
+                neighbors[write++] = neighbors[i];
+            }
+        }
+    }
+    cursor[numVertices] = write;
+    free(offsets);
+
+    g->numVertices = numVertices;
+    g->numEdges = write;
+    g->rowOffsets = cursor;
+    g->neighbors = neighbors;
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g);
+}
+
+// R-MAT generator with Graph500 parameters and scrambled ids (see Program 22)
+CSRGraph* generateRMAT(int scale, int edgeFactor, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    int n = 1 << scale;
+    long long m = (long long)edgeFactor * n;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * m);
+    int *permutation = (int*)allocOrExit(sizeof(int) * n);
+    uint64_t state = seed;
+
+    for (int v = 0; v < n; v++) {
+        permutation[v] = v;
+    }
+    for (int v = n - 1; v > 0; v--) {
+        int j = nextRandom(&state) % (v + 1);
+        int t = permutation[v];
+        permutation[v] = permutation[j];
+        permutation[j] = t;
+    }
+
+    for (long long e = 0; e < m; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0);
+            if (r >= a && r < a + b) {
+                v |= 1 << bit;
+            } else if (r >= a + b && r < a + b + c) {
+                u |= 1 << bit;
+            } else if (r >= a + b + c) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = permutation[u];
+        edges[e].dest = permutation[v];
+    }
+
+    free(permutation);
+    return buildCSR(n, edges, m);
+}
+
+// Function to relabel vertices in BFS order (see Program 23), which turns
+// neighbor ids into small gaps
+CSRGraph* relabelBFSOrder(CSRGraph *g) {
+    int n = g->numVertices;
+    int *oldToNew = (int*)allocOrExit(sizeof(int) * n);
+    int *queue = (int*)allocOrExit(sizeof(int) * n);
+    int next = 0;
+    for (int v = 0; v < n; v++) {
+        oldToNew[v] = -1;
+    }
+    for (int s = 0; s < n; s++) {
+        if (oldToNew[s] >= 0) {
+            continue;
+        }
+        int head = next;
+        oldToNew[s] = next;
+        queue[next++] = s;
+        while (head < next) {
+            int u = queue[head++];
+            for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+                int v = g->neighbors[k];
+                if (oldToNew[v] < 0) {
+                    oldToNew[v] = next;
+                    queue[next++] = v;
+                }
+            }
+        }
+    }
+
+    // queue[] is now newToOld
+    CSRGraph *r = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    r->numVertices = n;
+    r->numEdges = g->numEdges;
+    r->rowOffsets = (long long*)allocOrExit(sizeof(long long) * (n + 1));
+    r->neighbors = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+    long long pos = 0;
+    for (int i = 0; i < n; i++) {
+        int old = queue[i];
+        r->rowOffsets[i] = pos;
+        for (long long k = g->rowOffsets[old]; k < g->rowOffsets[old + 1]; k++) {
+            r->neighbors[pos++] = oldToNew[g->neighbors[k]];
+        }
+        qsort(r->neighbors + r->rowOffsets[i], pos - r->rowOffsets[i], sizeof(int), compareInts);
+    }
+    r->rowOffsets[n] = pos;
+    free(oldToNew);
+    free(queue);
+    return r;
+}
+
+// 2D grid (rows x cols, 4-neighbor) written straight into CSR (see Program 22)
+CSRGraph* generateGrid(int rows, int cols) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    int n = rows * cols;
+    g->numVertices = n;
+    g->rowOffsets = (long long*)allocOrExit(sizeof(long long) * (n + 1));
+    g->numEdges = 2LL * ((long long)rows * (cols - 1) + (long long)(rows - 1) * cols);
+    g->neighbors = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+
+    long long pos = 0;
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int v = r * cols + c;
+            g->rowOffsets[v] = pos;
+            if (r > 0) {
+                g->neighbors[pos++] = v - cols;
+            }
+            if (c > 0) {
+                g->neighbors[pos++] = v - 1;
+            }
+            if (c + 1 < cols) {
+                g->neighbors[pos++] = v + 1;
+            }
+            if (r + 1 < rows) {
+                g->neighbors[pos++] = v + cols;
+            }
+        }
+    }
+    g->rowOffsets[n] = pos;
+    return g;
+}
+
+size_t csrBytes(CSRGraph *g) {
+    return sizeof(long long) * (g->numVertices + 1) + sizeof(int) * g->numEdges;
+}
+
+// ==================== ENCODING ====================
+
+// Zigzag maps signed to unsigned so small magnitudes stay small
+static inline uint32_t zigzag(int value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int unzigzag(uint32_t value) {
+    return (int)(value >> 1) ^ -(int)(value & 1);
+}
+
+// Function to write a LEB128 varint; with out == NULL only counts bytes
+static inline int putVarint(uint8_t *out, uint32_t value) {
+    int length = 0;
+    while (value >= 0x80) {
+        if (out != NULL) {
+            out[length] = (uint8_t)(value | 0x80);
+        }
+        value >>= 7;
+        length++;
+    }
+    if (out != NULL) {
+        out[length] = (uint8_t)value;
+    }
+    return length + 1;
+}
+
+static inline uint32_t getVarint(const uint8_t **p) {
+    const uint8_t *q = *p;
+    uint32_t value = *q & 0x7F;
+    int shift = 7;
+    while (*q++ & 0x80) {
+        value |= (uint32_t)(*q & 0x7F) << shift;
+        shift += 7;
+    }
+    *p = q;
+    return value;
+}
+
+// Function to write up to 4 values as one group (missing values are 0);
+// with out == NULL only counts bytes
+static int putGroup(uint8_t *out, const uint32_t *values, int count) {
+    int length = 1;
+    uint8_t control = 0;
+    for (int i = 0; i < 4; i++) {
+        uint32_t value = i < count ? values[i] : 0;
+        int bytes = value < (1u << 8) ? 1 : value < (1u << 16) ? 2 : value < (1u << 24) ? 3 : 4;
+        control |= (uint8_t)((bytes - 1) << (2 * i));
+        for (int b = 0; b < bytes; b++) {
+            if (out != NULL) {
+                out[length] = (uint8_t)(value >> (8 * b));
+            }
+            length++;
+        }
+    }
+    if (out != NULL) {
+        out[0] = control;
+    }
+    return length;
+}
+
+// Function to fill the group varint decode tables
+void initGroupTables() {
+    for (int control = 0; control < 256; control++) {
+        int offset = 0;
+        for (int i = 0; i < 4; i++) {
+            int bytes = ((control >> (2 * i)) & 3) + 1;
+            for (int b = 0; b < 4; b++) {
+                groupShuffle[control][4 * i + b] = b < bytes ? (uint8_t)(offset + b) : 0x80;
+            }
+            offset += bytes;
+        }
+        groupLength[control] = (uint8_t)offset;
+    }
+}
+
+// Function to decode one group of 4 values; returns the next position
+static inline const uint8_t* getGroup(const uint8_t *p, uint32_t *values) {
+    uint8_t control = *p++;
+#ifdef __SSSE3__
+    __m128i data = _mm_loadu_si128((const __m128i*)p);
+    __m128i mask = _mm_loadu_si128((const __m128i*)groupShuffle[control]);
+    _mm_storeu_si128((__m128i*)values, _mm_shuffle_epi8(data, mask));
+#else
+    static const uint32_t byteMask[4] = {0xFF, 0xFFFF, 0xFFFFFF, 0xFFFFFFFF};
+    const uint8_t *q = p;
+    for (int i = 0; i < 4; i++) {
+        int bytes = ((control >> (2 * i)) & 3) + 1;
+        uint32_t word;
+        memcpy(&word, q, sizeof(word));
+        values[i] = word & byteMask[bytes - 1];
+        q += bytes;
+    }
+#endif
+    return p + groupLength[control];
+}
+
+// Function to compute the gap values of vertex v's sorted neighbor list
+static void listGaps(CSRGraph *g, int v, uint32_t *gaps) {
+    int previous = v;
+    for (long long k = g->rowOffsets[v]; k < g->rowOffsets[v + 1]; k++) {
+        int i = (int)(k - g->rowOffsets[v]);
+        int neighbor = g->neighbors[k];
+        gaps[i] = i == 0 ? zigzag(neighbor - v) : (uint32_t)(neighbor - previous - 1);
+        previous = neighbor;
+    }
+}
+
+// Function to encode one list; with out == NULL only counts bytes
+static long long encodeList(uint8_t *out, const uint32_t *gaps, int degree, Encoding encoding) {
+    long long length = putVarint(out, (uint32_t)degree);
+    if (encoding == ENC_VARINT) {
+        for (int i = 0; i < degree; i++) {
+            length += putVarint(out != NULL ? out + length : NULL, gaps[i]);
+        }
+    } else {
+        for (int i = 0; i < degree; i += 4) {
+            int count = degree - i < 4 ? degree - i : 4;
+            length += putGroup(out != NULL ? out + length : NULL, gaps + i, count);
+        }
+    }
+    return length;
+}
+
+// Function to compress a CSR graph (two passes: size, then write)
+CompressedGraph* compressGraph(CSRGraph *g, Encoding encoding) {
+    int n = g->numVertices;
+    CompressedGraph *cg = (CompressedGraph*)allocOrExit(sizeof(CompressedGraph));
+    cg->numVertices = n;
+    cg->numEdges = g->numEdges;
+    cg->encoding = encoding;
+    cg->byteOffsets = (long long*)allocOrExit(sizeof(long long) * (n + 1));
+
+    long long maxDegree = 0;
+    for (int v = 0; v < n; v++) {
+        if (g->rowOffsets[v + 1] - g->rowOffsets[v] > maxDegree) {
+            maxDegree = g->rowOffsets[v + 1] - g->rowOffsets[v];
+        }
+    }
+    uint32_t *gaps = (uint32_t*)allocOrExit(sizeof(uint32_t) * (maxDegree + 4));
+
+    long long total = 0;
+    for (int v = 0; v < n; v++) {
+        int degree = (int)(g->rowOffsets[v + 1] - g->rowOffsets[v]);
+        listGaps(g, v, gaps);
+        cg->byteOffsets[v] = total;
+        total += encodeList(NULL, gaps, degree, encoding);
+    }
+    cg->byteOffsets[n] = total;
+    cg->numBytes = total;
+    cg->bytes = (uint8_t*)allocOrExit(total + DECODE_PADDING);
+    memset(cg->bytes + total, 0, DECODE_PADDING);
+
+    for (int v = 0; v < n; v++) {
+        int degree = (int)(g->rowOffsets[v + 1] - g->rowOffsets[v]);
+        listGaps(g, v, gaps);
+        encodeList(cg->bytes + cg->byteOffsets[v], gaps, degree, encoding);
+    }
+    free(gaps);
+    return cg;
+}
+
+void freeCompressedGraph(CompressedGraph *cg) {
+    free(cg->byteOffsets);
+    free(cg->bytes);
+    free(cg);
+}
+
+size_t compressedBytes(CompressedGraph *cg) {
+    return sizeof(long long) * (cg->numVertices + 1) + cg->numBytes;
+}
+
+// ==================== DECODING ====================
+
+static inline void openNeighbors(CompressedGraph *cg, int v, NeighborCursor *cursor) {
+    cursor->p = cg->bytes + cg->byteOffsets[v];
+    cursor->remaining = (int)getVarint(&cursor->p);
+    cursor->previous = v;
+    cursor->first = true;
+    cursor->index = 0;
+    cursor->buffered = 0;
+}
+
+// Function to decode the next neighbor; returns false at the end of the list
+static inline bool nextNeighbor(NeighborCursor *cursor, Encoding encoding, int *neighbor) {
+    if (cursor->remaining == 0) {
+        return false;
+    }
+    uint32_t gap;
+    if (encoding == ENC_VARINT) {
+        gap = getVarint(&cursor->p);
+    } else {
+        if (cursor->index == cursor->buffered) {
+            cursor->p = getGroup(cursor->p, cursor->group);
+            cursor->index = 0;
+            cursor->buffered = 4;
+        }
+        gap = cursor->group[cursor->index++];
+    }
+    cursor->remaining--;
+    if (cursor->first) {
+        cursor->first = false;
+        cursor->previous += unzigzag(gap);
+    } else {
+        cursor->previous += (int)gap + 1;
+    }
+    *neighbor = cursor->previous;
+    return true;
+}
+
+// ==================== TRAVERSALS ====================
+
+// BFS on CSR; writes the visit order and returns its length
+int BFS(CSRGraph *g, int root, int *order, bool *visited) {
+    memset(visited, 0, g->numVertices);
+    int head = 0;
+    int tail = 0;
+    visited[root] = true;
+    order[tail++] = root;
+    while (head < tail) {
+        int u = order[head++];
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            if (!visited[v]) {
+                visited[v] = true;
+                order[tail++] = v;
+            }
+        }
+    }
+    return tail;
+}
+
+// BFS on the compressed graph, decoding each list as it is scanned
+int BFSCompressed(CompressedGraph *cg, int root, int *order, bool *visited) {
+    memset(visited, 0, cg->numVertices);
+    int head = 0;
+    int tail = 0;
+    visited[root] = true;
+    order[tail++] = root;
+    while (head < tail) {
+        NeighborCursor cursor;
+        int v;
+        openNeighbors(cg, order[head++], &cursor);
+        while (nextNeighbor(&cursor, cg->encoding, &v)) {
+            if (!visited[v]) {
+                visited[v] = true;
+                order[tail++] = v;
+            }
+        }
+    }
+    return tail;
+}
+
+// Iterative DFS on CSR (see Program 19); writes the visit order
+int DFS(CSRGraph *g, int root, int *order, bool *visited, DFSFrame *stack) {
+    memset(visited, 0, g->numVertices);
+    int top = 0;
+    int count = 0;
+    visited[root] = true;
+    order[count++] = root;
+    stack[top].vertex = root;
+    stack[top++].cursor = g->rowOffsets[root];
+    while (top > 0) {
+        DFSFrame *frame = &stack[top - 1];
+        if (frame->cursor < g->rowOffsets[frame->vertex + 1]) {
+            int v = g->neighbors[frame->cursor++];
+            if (!visited[v]) {
+                visited[v] = true;
+                order[count++] = v;
+                stack[top].vertex = v;
+                stack[top++].cursor = g->rowOffsets[v];
+            }
+        } else {
+            top--;
+        }
+    }
+    return count;
+}
+
+// Iterative DFS on the compressed graph: each frame keeps its decoding
+// cursor, so a list is decoded exactly once however often DFS returns to it
+int DFSCompressed(CompressedGraph *cg, int root, int *order, bool *visited, CompressedFrame *stack) {
+    memset(visited, 0, cg->numVertices);
+    int top = 0;
+    int count = 0;
+    visited[root] = true;
+    order[count++] = root;
+    stack[top].vertex = root;
+    openNeighbors(cg, root, &stack[top++].cursor);
+    while (top > 0) {
+        int v;
+        if (nextNeighbor(&stack[top - 1].cursor, cg->encoding, &v)) {
+            if (!visited[v]) {
+                visited[v] = true;
+                order[count++] = v;
+                stack[top].vertex = v;
+                openNeighbors(cg, v, &stack[top++].cursor);
+            }
+        } else {
+            top--;
+        }
+    }
+    return count;
+}
+
+// ==================== BENCHMARK ====================
+
+void runBenchmark(const char *name, CSRGraph *g) {
+    int n = g->numVertices;
+    printf("\n%s: %d vertices, %lld adjacency entries\n", name, n, g->numEdges);
+    if (g->numEdges == 0) {
+        printf("No non-isolated vertex to use as a root; skipping\n");
+        return;
+    }
+    printf("%-14s %9s %10s %7s %9s %9s %9s %9s %6s\n", "Format", "MB", "Bytes/adj", "Ratio",
+           "BFS ms", "Overhead", "DFS ms", "Overhead", "Same");
+    printf("-------------------------------------------------------------------------------------\n");
+
+    int roots[NUM_ROOTS];
+    uint64_t state = 5;
+    for (int r = 0; r < NUM_ROOTS; r++) {
+        do {
+            roots[r] = nextRandom(&state) % n;
+        } while (g->rowOffsets[roots[r] + 1] == g->rowOffsets[roots[r]]);
+    }
+    int *order = (int*)allocOrExit(sizeof(int) * n);
+    int *reference = (int*)allocOrExit(sizeof(int) * n);
+    int *dfsReference = (int*)allocOrExit(sizeof(int) * n);
+    bool *visited = (bool*)allocOrExit(n);
+    DFSFrame *stack = (DFSFrame*)allocOrExit(sizeof(DFSFrame) * n);
+    CompressedFrame *compressedStack = (CompressedFrame*)allocOrExit(sizeof(CompressedFrame) * n);
+
+    // Uncompressed CSR baseline (the orders from the first root are kept)
+    double bfsBase = 0;
+    double dfsBase = 0;
+    for (int r = 0; r < NUM_ROOTS; r++) {
+        double start = getTimeSeconds();
+        BFS(g, roots[r], r == 0 ? reference : order, visited);
+        bfsBase += getTimeSeconds() - start;
+        start = getTimeSeconds();
+        DFS(g, roots[r], r == 0 ? dfsReference : order, visited, stack);
+        dfsBase += getTimeSeconds() - start;
+    }
+    size_t baseBytes = csrBytes(g);
+    printf("%-14s %9.1f %10.2f %6.2fx %9.1f %9s %9.1f %9s %6s\n", "CSR", baseBytes / 1048576.0,
+           (double)baseBytes / g->numEdges, 1.0, bfsBase / NUM_ROOTS * 1000, "-",
+           dfsBase / NUM_ROOTS * 1000, "-", "-");
+
+    const char *names[] = {"Varint", "Group varint"};
+    Encoding encodings[] = {ENC_VARINT, ENC_GROUP_VARINT};
+    for (int e = 0; e < 2; e++) {
+        CompressedGraph *cg = compressGraph(g, encodings[e]);
+        double bfsTime = 0;
+        double dfsTime = 0;
+        bool same = true;
+        for (int r = 0; r < NUM_ROOTS; r++) {
+            double start = getTimeSeconds();
+            int count = BFSCompressed(cg, roots[r], order, visited);
+            bfsTime += getTimeSeconds() - start;
+            if (r == 0) {
+                same &= memcmp(order, reference, sizeof(int) * count) == 0;
+            }
+            start = getTimeSeconds();
+            count = DFSCompressed(cg, roots[r], order, visited, compressedStack);
+            dfsTime += getTimeSeconds() - start;
+            if (r == 0) {
+                same &= memcmp(order, dfsReference, sizeof(int) * count) == 0;
+            }
+        }
+        size_t bytes = compressedBytes(cg);
+        printf("%-14s %9.1f %10.2f %6.2fx %9.1f %8.0f%% %9.1f %8.0f%% %6s\n", names[e], bytes / 1048576.0,
+               (double)bytes / g->numEdges, (double)baseBytes / bytes, bfsTime / NUM_ROOTS * 1000,
+               (bfsTime / bfsBase - 1) * 100, dfsTime / NUM_ROOTS * 1000, (dfsTime / dfsBase - 1) * 100,
+               same ? "yes" : "NO");
+        freeCompressedGraph(cg);
+    }
+
+    free(order);
+    free(reference);
+    free(dfsReference);
+    free(visited);
+    free(stack);
+    free(compressedStack);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  COMPRESSED ADJACENCY STORAGE\n");
+    printf("  Delta + Varint Neighbor Lists\n");
+    printf("=========================================\n\n");
+    initGroupTables();
+
+    // Program 5's example graph, encoded byte by byte
+    printf("Example: Program 5's graph\n\n");
+    printf("    0 --- 1 --- 2\n");
+    printf("    |     |     |\n");
+    printf("    3 --- 4 --- 5\n\n");
+    Edge demo[] = {{0, 1}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {4, 5}};
+    Edge *demoEdges = (Edge*)allocOrExit(sizeof(demo));
+    memcpy(demoEdges, demo, sizeof(demo));
+    CSRGraph *g = buildCSR(6, demoEdges, 7);
+    CompressedGraph *cg = compressGraph(g, ENC_VARINT);
+    for (int v = 0; v < 6; v++) {
+        printf("Vertex %d: neighbors", v);
+        for (long long k = g->rowOffsets[v]; k < g->rowOffsets[v + 1]; k++) {
+            printf(" %d", g->neighbors[k]);
+        }
+        printf("  ->  bytes");
+        for (long long b = cg->byteOffsets[v]; b < cg->byteOffsets[v + 1]; b++) {
+            printf(" %02x", cg->bytes[b]);
+        }
+        printf("  (degree, zigzag first gap, gaps - 1)\n");
+    }
+    int order[6];
+    bool visited[6];
+    int count = BFSCompressed(cg, 0, order, visited);
+    printf("\nBFS from 0 on the compressed graph: ");
+    for (int i = 0; i < count; i++) {
+        printf("%d ", order[i]);
+    }
+    printf("\n");
+    freeCompressedGraph(cg);
+    freeCSR(g);
+
+    int scale = 20;
+    if (argc > 1) {
+        scale = atoi(argv[1]);
+    }
+    if (scale < 4 || scale > 26) {
+        printf("Usage: %s [scale 4-26]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (%d roots, times per traversal):\n", NUM_ROOTS);
+    printf("-------------------------------------------\n");
+#ifdef __SSSE3__
+    printf("Group varint decoding: SSSE3 shuffle\n");
+#else
+    printf("Group varint decoding: scalar (compile with -mssse3 for SIMD shuffle)\n");
+#endif
+
+    char name[64];
+    g = generateRMAT(scale, 16, 11);
+    snprintf(name, sizeof(name), "R-MAT scale %d, scrambled ids", scale);
+    runBenchmark(name, g);
+
+    CSRGraph *ordered = relabelBFSOrder(g);
+    freeCSR(g);
+    snprintf(name, sizeof(name), "R-MAT scale %d, BFS order", scale);
+    runBenchmark(name, ordered);
+    freeCSR(ordered);
+
+    int side = 1 << (scale / 2);
+    g = generateGrid(side, side);
+    snprintf(name, sizeof(name), "%dx%d grid", side, side);
+    runBenchmark(name, g);
+    freeCSR(g);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
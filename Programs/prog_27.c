@@ -0,0 +1,516 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define INITIAL_CAPACITY 16
+
+// Push bulk items one by one while there are fewer than this many per
+// existing element; otherwise append them and rebuild in O(n)
+#define BULK_REBUILD_RATIO 2
+
+// Task for the priority-queue example
+typedef struct {
+    int priority;
+    int id;
+    const char *name;
+} Task;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+void* reallocOrExit(void *memory, size_t bytes) {
+    void *grown = realloc(memory, bytes);
+    if (grown == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return grown;
+}
+
+// ==================== HEAP ENGINE ====================
+
+// One binary heap implementation, instantiated per element type and order.
+// BEFORE(h, a, b) is true when a must be closer to the top than b; it is
+// expanded inline, so a min-heap of ints compiles to plain '<' comparisons.
+// For orders chosen at run time, BEFORE can call h->compare instead.
+//
+// Generated API for DEFINE_HEAP(Name, Type, BEFORE):
+//   Name##Init(h, capacity)         Name##Free(h)
+//   Name##Push(h, item)             Name##PushBulk(h, items, count)
+//   Name##Peek(h)                   Name##Pop(h)
+//   Name##ReplaceTop(h, item)       Name##RemoveAt(h, index)
+//   Name##Build(h, items, count)    Name##IsValid(h)
+//
+// Both sifts are iterative and hole-based: the moving item is held in a
+// local while others shift into the hole, one move per level instead of
+// a three-assignment swap, and it is written once at its final position.
+#define DEFINE_HEAP(Name, Type, BEFORE)                                             \
+typedef struct {                                                                    \
+    Type *data;                                                                     \
+    int size;                                                                       \
+    int capacity;                                                                   \
+    int (*compare)(const Type *a, const Type *b); /* Used by run-time orders */     \
+} Name;                                                                             \
+                                                                                    \
+static inline void Name##Init(Name *h, int capacity) {                              \
+    h->capacity = capacity > 0 ? capacity : INITIAL_CAPACITY;                       \
+    h->data = (Type*)allocOrExit(sizeof(Type) * h->capacity);                       \
+    h->size = 0;                                                                    \
+    h->compare = NULL;                                                              \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Free(Name *h) {                                            \
+    free(h->data);                                                                  \
+    h->data = NULL;                                                                 \
+    h->size = 0;                                                                    \
+    h->capacity = 0;                                                                \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Reserve(Name *h, int needed) {                             \
+    if (needed > h->capacity) {                                                     \
+        while (h->capacity < needed) {                                              \
+            h->capacity = h->capacity > 0 ? h->capacity * 2 : INITIAL_CAPACITY;     \
+        }                                                                           \
+        h->data = (Type*)reallocOrExit(h->data, sizeof(Type) * h->capacity);        \
+    }                                                                               \
+}                                                                                   \
+                                                                                    \
+/* Move item up from the hole at index; returns its final position */               \
+static inline int Name##SiftUp(Name *h, int index, Type item) {                     \
+    while (index > 0) {                                                             \
+        int parent = (index - 1) / 2;                                               \
+        if (!(BEFORE(h, item, h->data[parent]))) {                                  \
+            break;                                                                  \
+        }                                                                           \
+        h->data[index] = h->data[parent];                                           \
+        index = parent;                                                             \
+    }                                                                               \
+    h->data[index] = item;                                                          \
+    return index;                                                                   \
+}                                                                                   \
+                                                                                    \
+/* Move item down from the hole at index; returns its final position */             \
+static inline int Name##SiftDown(Name *h, int index, Type item) {                   \
+    int size = h->size;                                                             \
+    int child = 2 * index + 1;                                                      \
+    while (child < size) {                                                          \
+        if (child + 1 < size) {                                                     \
+            child += BEFORE(h, h->data[child + 1], h->data[child]);                 \
+        }                                                                           \
+        if (!(BEFORE(h, h->data[child], item))) {                                   \
+            break;                                                                  \
+        }                                                                           \
+        h->data[index] = h->data[child];                                            \
+        index = child;                                                              \
+        child = 2 * index + 1;                                                      \
+    }                                                                               \
+    h->data[index] = item;                                                          \
+    return index;                                                                   \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Push(Name *h, Type item) {                                 \
+    Name##Reserve(h, h->size + 1);                                                  \
+    Name##SiftUp(h, h->size++, item);                                               \
+}                                                                                   \
+                                                                                    \
+/* Top element; the heap must not be empty */                                       \
+static inline Type Name##Peek(Name *h) {                                            \
+    return h->data[0];                                                              \
+}                                                                                   \
+                                                                                    \
+/* Remove and return the top element; the heap must not be empty. The last          \
+   element almost always belongs near the bottom, so the hole is first moved        \
+   to a leaf along the smaller children without comparing against it, then          \
+   the element sifts up the few levels it needs (bottom-up pop). */                 \
+static inline Type Name##Pop(Name *h) {                                             \
+    Type top = h->data[0];                                                          \
+    Type last = h->data[--h->size];                                                 \
+    int size = h->size;                                                             \
+    int index = 0;                                                                  \
+    int child = 1;                                                                  \
+    while (child + 1 < size) {                                                      \
+        child += BEFORE(h, h->data[child + 1], h->data[child]);                     \
+        h->data[index] = h->data[child];                                            \
+        index = child;                                                              \
+        child = 2 * index + 1;                                                      \
+    }                                                                               \
+    if (child < size) {                                                             \
+        h->data[index] = h->data[child];                                            \
+        index = child;                                                              \
+    }                                                                               \
+    if (size > 0) {                                                                 \
+        Name##SiftUp(h, index, last);                                               \
+    }                                                                               \
+    return top;                                                                     \
+}                                                                                   \
+                                                                                    \
+/* Pop followed by push in a single sift; the heap must not be empty */             \
+static inline Type Name##ReplaceTop(Name *h, Type item) {                           \
+    Type top = h->data[0];                                                          \
+    Name##SiftDown(h, 0, item);                                                     \
+    return top;                                                                     \
+}                                                                                   \
+                                                                                    \
+/* Remove the element at a position (e.g. one found by a search) */                 \
+static inline Type Name##RemoveAt(Name *h, int index) {                             \
+    Type removed = h->data[index];                                                  \
+    Type last = h->data[--h->size];                                                 \
+    if (index < h->size) {                                                          \
+        if (Name##SiftUp(h, index, last) == index) {                                \
+            Name##SiftDown(h, index, last);                                         \
+        }                                                                           \
+    }                                                                               \
+    return removed;                                                                 \
+}                                                                                   \
+                                                                                    \
+/* Floyd's bottom-up heap construction over the current contents: O(n) */           \
+static inline void Name##Heapify(Name *h) {                                         \
+    for (int i = h->size / 2 - 1; i >= 0; i--) {                                    \
+        Name##SiftDown(h, i, h->data[i]);                                           \
+    }                                                                               \
+}                                                                                   \
+                                                                                    \
+/* Replace the contents with items and heapify */                                   \
+static inline void Name##Build(Name *h, const Type *items, int count) {             \
+    Name##Reserve(h, count);                                                        \
+    memcpy(h->data, items, sizeof(Type) * count);                                   \
+    h->size = count;                                                                \
+    Name##Heapify(h);                                                               \
+}                                                                                   \
+                                                                                    \
+/* Add many items: sifting each costs O(k log n), rebuilding costs O(n + k) */      \
+static inline void Name##PushBulk(Name *h, const Type *items, int count) {          \
+    Name##Reserve(h, h->size + count);                                              \
+    if (count < h->size * BULK_REBUILD_RATIO) {                                     \
+        for (int i = 0; i < count; i++) {                                           \
+            Name##SiftUp(h, h->size++, items[i]);                                   \
+        }                                                                           \
+    } else {                                                                        \
+        memcpy(h->data + h->size, items, sizeof(Type) * count);                     \
+        h->size += count;                                                           \
+        Name##Heapify(h);                                                           \
+    }                                                                               \
+}                                                                                   \
+                                                                                    \
+static inline bool Name##IsValid(Name *h) {                                         \
+    for (int i = 1; i < h->size; i++) {                                             \
+        if (BEFORE(h, h->data[i], h->data[(i - 1) / 2])) {                          \
+            return false;                                                           \
+        }                                                                           \
+    }                                                                               \
+    return true;                                                                    \
+}
+
+// Orders
+#define LESS_THAN(h, a, b) ((a) < (b))
+#define GREATER_THAN(h, a, b) ((a) > (b))
+#define BY_COMPARATOR(h, a, b) ((h)->compare(&(a), &(b)) < 0)
+#define TASK_BEFORE(h, a, b) ((a).priority < (b).priority || \
+                              ((a).priority == (b).priority && (a).id < (b).id))
+
+DEFINE_HEAP(IntMinHeap, int, LESS_THAN)
+DEFINE_HEAP(IntMaxHeap, int, GREATER_THAN)
+DEFINE_HEAP(IntHeap, int, BY_COMPARATOR)
+DEFINE_HEAP(TaskQueue, Task, TASK_BEFORE)
+
+// Run-time comparator for IntHeap (qsort convention)
+int compareAscending(const int *a, const int *b) {
+    return (*a > *b) - (*a < *b);
+}
+
+// ==================== PROGRAM 6 BASELINE ====================
+
+// Program 6's min heap algorithms (recursive heapify with swap calls), on a
+// growable array so it can hold the benchmark sizes
+typedef struct {
+    int *data;
+    int size;
+    int capacity;
+} SwapMinHeap;
+
+void swap(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+void swapHeapifyUp(SwapMinHeap *h, int index) {
+    while (index > 0 && h->data[(index - 1) / 2] > h->data[index]) {
+        swap(&h->data[index], &h->data[(index - 1) / 2]);
+        index = (index - 1) / 2;
+    }
+}
+
+void swapHeapifyDown(SwapMinHeap *h, int index) {
+    int smallest = index;
+    int left = 2 * index + 1;
+    int right = 2 * index + 2;
+    if (left < h->size && h->data[left] < h->data[smallest]) {
+        smallest = left;
+    }
+    if (right < h->size && h->data[right] < h->data[smallest]) {
+        smallest = right;
+    }
+    if (smallest != index) {
+        swap(&h->data[index], &h->data[smallest]);
+        swapHeapifyDown(h, smallest);
+    }
+}
+
+void swapInsert(SwapMinHeap *h, int value) {
+    if (h->size == h->capacity) {
+        h->capacity *= 2;
+        h->data = (int*)reallocOrExit(h->data, sizeof(int) * h->capacity);
+    }
+    h->data[h->size] = value;
+    swapHeapifyUp(h, h->size);
+    h->size++;
+}
+
+// Extract-min added the usual way: move the last element to the root
+int swapExtractMin(SwapMinHeap *h) {
+    int top = h->data[0];
+    h->data[0] = h->data[--h->size];
+    swapHeapifyDown(h, 0);
+    return top;
+}
+
+void swapBuild(SwapMinHeap *h, const int *items, int count) {
+    memcpy(h->data, items, sizeof(int) * count);
+    h->size = count;
+    for (int i = count / 2 - 1; i >= 0; i--) {
+        swapHeapifyDown(h, i);
+    }
+}
+
+// ==================== DISPLAY ====================
+
+// Display heap in tree structure (as in Program 6)
+void displayHeapTree(const int heap[], int size, const char *type) {
+    printf("%s Heap Tree Structure:\n", type);
+    int level = 0;
+    int nodesInLevel = 1;
+    int index = 0;
+    while (index < size) {
+        printf("  Level %d: ", level);
+        for (int i = 0; i < nodesInLevel && index < size; i++) {
+            printf("%d ", heap[index++]);
+        }
+        printf("\n");
+        level++;
+        nodesInLevel *= 2;
+    }
+}
+
+// ==================== BENCHMARK ====================
+
+// Function to time push-all then pop-all, heapify then pop-all, and a
+// replace-top stream for each implementation
+void runBenchmark(int n) {
+    int *items = (int*)allocOrExit(sizeof(int) * n);
+    int *out = (int*)allocOrExit(sizeof(int) * n);
+    uint64_t state = (uint64_t)n * 31 + 7;
+    for (int i = 0; i < n; i++) {
+        items[i] = (int)(nextRandom(&state) >> 33);
+    }
+
+    double start, pushTime, popTime, buildTime, replaceTime;
+    bool sorted;
+    printf("\n%d elements\n", n);
+    printf("%-26s %10s %10s %10s %12s %7s\n", "Implementation", "Push ns", "Pop ns", "Build ns", "Replace ns", "Sorted");
+    printf("---------------------------------------------------------------------------------\n");
+
+    // Program 6 algorithms
+    SwapMinHeap swapHeap;
+    swapHeap.capacity = INITIAL_CAPACITY;
+    swapHeap.data = (int*)allocOrExit(sizeof(int) * swapHeap.capacity);
+    swapHeap.size = 0;
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        swapInsert(&swapHeap, items[i]);
+    }
+    pushTime = getTimeSeconds() - start;
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        out[i] = swapExtractMin(&swapHeap);
+    }
+    popTime = getTimeSeconds() - start;
+    sorted = true;
+    for (int i = 1; i < n; i++) {
+        sorted &= out[i - 1] <= out[i];
+    }
+    start = getTimeSeconds();
+    swapBuild(&swapHeap, items, n);
+    buildTime = getTimeSeconds() - start;
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        swapHeap.data[0] = items[i] ^ 0x5555;
+        swapHeapifyDown(&swapHeap, 0);
+    }
+    replaceTime = getTimeSeconds() - start;
+    printf("%-26s %10.1f %10.1f %10.1f %12.1f %7s\n", "Program 6 (swap, recursive)",
+           pushTime / n * 1e9, popTime / n * 1e9, buildTime / n * 1e9, replaceTime / n * 1e9,
+           sorted ? "yes" : "NO");
+    free(swapHeap.data);
+
+    // Engine with a run-time comparator, then with the inlined order
+    for (int variant = 0; variant < 2; variant++) {
+        IntHeap generic;
+        IntMinHeap inlined;
+        IntHeapInit(&generic, 0);
+        generic.compare = compareAscending;
+        IntMinHeapInit(&inlined, 0);
+
+        start = getTimeSeconds();
+        for (int i = 0; i < n; i++) {
+            if (variant == 0) {
+                IntHeapPush(&generic, items[i]);
+            } else {
+                IntMinHeapPush(&inlined, items[i]);
+            }
+        }
+        pushTime = getTimeSeconds() - start;
+        start = getTimeSeconds();
+        for (int i = 0; i < n; i++) {
+            out[i] = variant == 0 ? IntHeapPop(&generic) : IntMinHeapPop(&inlined);
+        }
+        popTime = getTimeSeconds() - start;
+        sorted = true;
+        for (int i = 1; i < n; i++) {
+            sorted &= out[i - 1] <= out[i];
+        }
+        start = getTimeSeconds();
+        if (variant == 0) {
+            IntHeapBuild(&generic, items, n);
+        } else {
+            IntMinHeapBuild(&inlined, items, n);
+        }
+        buildTime = getTimeSeconds() - start;
+        start = getTimeSeconds();
+        for (int i = 0; i < n; i++) {
+            if (variant == 0) {
+                IntHeapReplaceTop(&generic, items[i] ^ 0x5555);
+            } else {
+                IntMinHeapReplaceTop(&inlined, items[i] ^ 0x5555);
+            }
+        }
+        replaceTime = getTimeSeconds() - start;
+        printf("%-26s %10.1f %10.1f %10.1f %12.1f %7s\n",
+               variant == 0 ? "Engine, comparator call" : "Engine, inlined min",
+               pushTime / n * 1e9, popTime / n * 1e9, buildTime / n * 1e9, replaceTime / n * 1e9,
+               sorted ? "yes" : "NO");
+        IntHeapFree(&generic);
+        IntMinHeapFree(&inlined);
+    }
+
+    free(items);
+    free(out);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  GENERIC GROWABLE BINARY HEAP\n");
+    printf("  One Engine, Min/Max/Custom Orders\n");
+    printf("=========================================\n\n");
+
+    // Program 6's test array through both instantiations
+    int arr1[] = {15, 10, 20, 8, 12, 25, 6};
+    int n1 = sizeof(arr1) / sizeof(arr1[0]);
+    printf("Original Array: ");
+    for (int i = 0; i < n1; i++) {
+        printf("%d ", arr1[i]);
+    }
+    printf("\n\n");
+
+    IntMinHeap minHeap;
+    IntMaxHeap maxHeap;
+    IntMinHeapInit(&minHeap, 4);
+    IntMaxHeapInit(&maxHeap, 4);
+    IntMinHeapBuild(&minHeap, arr1, n1);
+    IntMaxHeapBuild(&maxHeap, arr1, n1);
+    displayHeapTree(minHeap.data, minHeap.size, "Min");
+    displayHeapTree(maxHeap.data, maxHeap.size, "Max");
+    printf("Min Heap Valid: %s, Max Heap Valid: %s, capacity grew 4 -> %d\n",
+           IntMinHeapIsValid(&minHeap) ? "YES" : "NO", IntMaxHeapIsValid(&maxHeap) ? "YES" : "NO",
+           minHeap.capacity);
+
+    printf("\nPeek min: %d, peek max: %d\n", IntMinHeapPeek(&minHeap), IntMaxHeapPeek(&maxHeap));
+    int replaced = IntMinHeapReplaceTop(&minHeap, 30);
+    printf("ReplaceTop(min, 30) returned %d, new min %d\n", replaced, IntMinHeapPeek(&minHeap));
+    printf("RemoveAt(min, 2) removed %d\n", IntMinHeapRemoveAt(&minHeap, 2));
+    int more[] = {1, 40, 3};
+    IntMinHeapPushBulk(&minHeap, more, 3);
+    printf("PushBulk {1, 40, 3}, valid: %s\n", IntMinHeapIsValid(&minHeap) ? "YES" : "NO");
+    printf("Pop all (min): ");
+    while (minHeap.size > 0) {
+        printf("%d ", IntMinHeapPop(&minHeap));
+    }
+    printf("\nPop all (max): ");
+    while (maxHeap.size > 0) {
+        printf("%d ", IntMaxHeapPop(&maxHeap));
+    }
+    printf("\n");
+    IntMinHeapFree(&minHeap);
+    IntMaxHeapFree(&maxHeap);
+
+    // A struct payload with a two-key order
+    printf("\nTask queue (priority, then arrival):\n");
+    TaskQueue tasks;
+    TaskQueueInit(&tasks, 0);
+    Task incoming[] = {{3, 0, "write report"}, {1, 1, "fix outage"}, {2, 2, "review PR"},
+                       {1, 3, "page on-call"}, {3, 4, "update docs"}};
+    for (int i = 0; i < 5; i++) {
+        TaskQueuePush(&tasks, incoming[i]);
+    }
+    while (tasks.size > 0) {
+        Task t = TaskQueuePop(&tasks);
+        printf("  [p%d #%d] %s\n", t.priority, t.id, t.name);
+    }
+    TaskQueueFree(&tasks);
+
+    int maxElements = 10000000;
+    if (argc > 1) {
+        maxElements = atoi(argv[1]);
+    }
+    if (maxElements < 1000) {
+        printf("Usage: %s [maxElements >= 1000]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (random ints, time per operation):\n");
+    printf("-------------------------------------------");
+    for (int n = 1000000; n <= maxElements; n *= 10) {
+        runBenchmark(n);
+    }
+    if (maxElements < 1000000) {
+        runBenchmark(maxElements);
+    }
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
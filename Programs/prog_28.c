@@ -0,0 +1,344 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#define CACHE_LINE 64
+#define INITIAL_CAPACITY 1024
+
+// Empty slots hold this value, so a partly filled child group needs no
+// bounds checks; keys must be smaller
+#define EMPTY_KEY INT_MAX
+
+// Timings of one workload
+typedef struct {
+    double pushNs;
+    double holdNs;
+    double popNs;
+    uint64_t checksum;
+    bool sorted;
+} MixResult;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// Function to allocate cache-line aligned ints, all set to EMPTY_KEY
+int* allocKeys(size_t count) {
+    size_t bytes = (count * sizeof(int) + CACHE_LINE - 1) & ~(size_t)(CACHE_LINE - 1);
+    int *keys = (int*)aligned_alloc(CACHE_LINE, bytes);
+    if (keys == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < bytes / sizeof(int); i++) {
+        keys[i] = EMPTY_KEY;
+    }
+    return keys;
+}
+
+// ==================== SMALLEST CHILD ====================
+
+// Function to find the position of the smallest of 'arity' keys. The
+// scalar version is a chain of conditional moves (no branches); with AVX2,
+// groups of 8 and 16 are reduced with vector minimums and the position is
+// read from a comparison mask.
+static inline int smallestChild(const int *group, int arity) {
+#ifdef __AVX2__
+    if (arity == 8 || arity == 16) {
+        __m256i v = _mm256_load_si256((const __m256i*)group);
+        __m256i m = v;
+        if (arity == 16) {
+            m = _mm256_min_epi32(m, _mm256_load_si256((const __m256i*)(group + 8)));
+        }
+        m = _mm256_min_epi32(m, _mm256_permute2x128_si256(m, m, 1));
+        m = _mm256_min_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+        m = _mm256_min_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+        uint32_t mask = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, m)));
+        if (arity == 16) {
+            __m256i w = _mm256_load_si256((const __m256i*)(group + 8));
+            mask |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(w, m))) << 8;
+        }
+        return __builtin_ctz(mask);
+    }
+#endif
+    int best = 0;
+    for (int k = 1; k < arity; k++) {
+        best = group[k] < group[best] ? k : best;
+    }
+    return best;
+}
+
+// ==================== D-ARY HEAP ENGINE ====================
+
+// Min-heap of ints with ARITY children per node, instantiated per arity so
+// the child arithmetic and smallestChild() are specialized at compile time.
+//
+// Layout: children of node i are ARITY * i + 1 .. ARITY * i + ARITY. The
+// array starts ARITY - 1 slots into a cache-line aligned block, which puts
+// every child group at an ARITY-aligned slot: a group of 4 ints (16 bytes)
+// or 8 ints (32 bytes) never straddles a cache line, and a group of 16 is
+// exactly one line. Finding the smallest child therefore costs one miss per
+// level, and the tree has log_ARITY(n) levels instead of log_2(n).
+//
+// Generated API for DEFINE_DARY_HEAP(Name, ARITY):
+//   Name##Init(h)   Name##Free(h)   Name##Push(h, key)   Name##Peek(h)
+//   Name##Pop(h)    Name##IsValid(h)
+#define DEFINE_DARY_HEAP(Name, ARITY)                                               \
+typedef struct {                                                                    \
+    int *block;               /* Aligned allocation */                              \
+    int *data;                /* block + ARITY - 1 */                               \
+    int size;                                                                       \
+    int capacity;                                                                   \
+} Name;                                                                             \
+                                                                                    \
+static inline void Name##Init(Name *h) {                                            \
+    h->capacity = INITIAL_CAPACITY;                                                 \
+    h->block = allocKeys((size_t)h->capacity + 2 * (ARITY));                        \
+    h->data = h->block + (ARITY) - 1;                                               \
+    h->size = 0;                                                                    \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Free(Name *h) {                                            \
+    free(h->block);                                                                 \
+}                                                                                   \
+                                                                                    \
+/* Doubling; aligned memory cannot be realloc'd, so copy into a new block */        \
+static void Name##Grow(Name *h) {                                                   \
+    int *block = allocKeys((size_t)h->capacity * 2 + 2 * (ARITY));                  \
+    memcpy(block + (ARITY) - 1, h->data, sizeof(int) * h->size);                    \
+    free(h->block);                                                                 \
+    h->block = block;                                                               \
+    h->data = block + (ARITY) - 1;                                                  \
+    h->capacity *= 2;                                                               \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Push(Name *h, int key) {                                   \
+    if (h->size == h->capacity) {                                                   \
+        Name##Grow(h);                                                              \
+    }                                                                               \
+    int index = h->size++;                                                          \
+    while (index > 0) {                                                             \
+        int parent = (index - 1) / (ARITY);                                         \
+        if (h->data[parent] <= key) {                                               \
+            break;                                                                  \
+        }                                                                           \
+        h->data[index] = h->data[parent];                                           \
+        index = parent;                                                             \
+    }                                                                               \
+    h->data[index] = key;                                                           \
+}                                                                                   \
+                                                                                    \
+static inline int Name##Peek(Name *h) {                                             \
+    return h->data[0];                                                              \
+}                                                                                   \
+                                                                                    \
+/* Bottom-up pop (see Program 27): move the hole to a leaf along the                \
+   smallest children, then sift the last key up from there */                       \
+static inline int Name##Pop(Name *h) {                                              \
+    int top = h->data[0];                                                           \
+    int last = h->data[--h->size];                                                  \
+    h->data[h->size] = EMPTY_KEY;                                                   \
+    int size = h->size;                                                             \
+    int index = 0;                                                                  \
+    int first = 1;                                                                  \
+    while (first < size) {                                                          \
+        int child = first + smallestChild(h->data + first, (ARITY));                \
+        h->data[index] = h->data[child];                                            \
+        index = child;                                                              \
+        first = (ARITY) * index + 1;                                                \
+    }                                                                               \
+    while (index > 0) {                                                             \
+        int parent = (index - 1) / (ARITY);                                         \
+        if (h->data[parent] <= last) {                                              \
+            break;                                                                  \
+        }                                                                           \
+        h->data[index] = h->data[parent];                                           \
+        index = parent;                                                             \
+    }                                                                               \
+    h->data[index] = size > 0 ? last : EMPTY_KEY;                                   \
+    return top;                                                                     \
+}                                                                                   \
+                                                                                    \
+static inline bool Name##IsValid(Name *h) {                                         \
+    for (int i = 1; i < h->size; i++) {                                             \
+        if (h->data[i] < h->data[(i - 1) / (ARITY)]) {                              \
+            return false;                                                           \
+        }                                                                           \
+    }                                                                               \
+    return true;                                                                    \
+}                                                                                   \
+                                                                                    \
+/* Fill with n keys, then n hold operations (pop, push popped + delta, as in        \
+   an event simulation), then pop everything */                                     \
+static void Name##RunMix(const int *keys, const int *deltas, int n, MixResult *r) { \
+    Name h;                                                                         \
+    Name##Init(&h);                                                                 \
+    double start = getTimeSeconds();                                                \
+    for (int i = 0; i < n; i++) {                                                   \
+        Name##Push(&h, keys[i]);                                                    \
+    }                                                                               \
+    r->pushNs = (getTimeSeconds() - start) / n * 1e9;                               \
+    start = getTimeSeconds();                                                       \
+    for (int i = 0; i < n; i++) {                                                   \
+        Name##Push(&h, Name##Pop(&h) + deltas[i]);                                  \
+    }                                                                               \
+    r->holdNs = (getTimeSeconds() - start) / n * 1e9;                               \
+    r->sorted = Name##IsValid(&h);                                                  \
+    r->checksum = 0;                                                                \
+    int previous = INT_MIN;                                                         \
+    start = getTimeSeconds();                                                       \
+    for (int i = 0; i < n; i++) {                                                   \
+        int key = Name##Pop(&h);                                                    \
+        r->sorted &= previous <= key;                                               \
+        r->checksum = r->checksum * 31 + (uint64_t)key;                             \
+        previous = key;                                                             \
+    }                                                                               \
+    r->popNs = (getTimeSeconds() - start) / n * 1e9;                                \
+    Name##Free(&h);                                                                 \
+}
+
+DEFINE_DARY_HEAP(BinaryHeap, 2)
+DEFINE_DARY_HEAP(QuaternaryHeap, 4)
+DEFINE_DARY_HEAP(OctaryHeap, 8)
+DEFINE_DARY_HEAP(HexadecaryHeap, 16)
+
+// ==================== BENCHMARK ====================
+
+void runBenchmark(int n) {
+    int *keys = (int*)malloc(sizeof(int) * (size_t)n);
+    int *deltas = (int*)malloc(sizeof(int) * (size_t)n);
+    if (keys == NULL || deltas == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    uint64_t state = 12345;
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(nextRandom(&state) >> 36);           // [0, 2^28)
+        deltas[i] = (int)(nextRandom(&state) >> 44);         // [0, 2^20)
+    }
+
+    printf("\n%d elements (%.0f MB of keys)\n", n, n * 4.0 / 1048576);
+    printf("%-10s %7s %10s %10s %10s %10s %7s\n", "Heap", "Levels", "Push ns", "Hold ns", "Pop ns", "vs binary", "Valid");
+    printf("---------------------------------------------------------------------\n");
+
+    const char *names[] = {"binary", "4-ary", "8-ary", "16-ary"};
+    int arities[] = {2, 4, 8, 16};
+    MixResult results[4];
+    for (int i = 0; i < 4; i++) {
+        switch (arities[i]) {
+            case 2:
+                BinaryHeapRunMix(keys, deltas, n, &results[i]);
+                break;
+            case 4:
+                QuaternaryHeapRunMix(keys, deltas, n, &results[i]);
+                break;
+            case 8:
+                OctaryHeapRunMix(keys, deltas, n, &results[i]);
+                break;
+            default:
+                HexadecaryHeapRunMix(keys, deltas, n, &results[i]);
+                break;
+        }
+        int levels = 0;
+        for (long long reach = 1, width = 1; reach <= n; levels++) {
+            width *= arities[i];
+            reach += width;
+        }
+        double binaryTotal = results[0].holdNs + results[0].popNs;
+        double total = results[i].holdNs + results[i].popNs;
+        bool valid = results[i].sorted && results[i].checksum == results[0].checksum;
+        printf("%-10s %7d %10.1f %10.1f %10.1f %9.2fx %7s\n", names[i], levels + 1, results[i].pushNs,
+               results[i].holdNs, results[i].popNs, binaryTotal / total, valid ? "yes" : "NO");
+    }
+
+    free(keys);
+    free(deltas);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  CACHE-ALIGNED D-ARY HEAP\n");
+    printf("  4-, 8- and 16-ary vs Binary\n");
+    printf("=========================================\n\n");
+
+    // Program 6's test array in a 4-ary heap
+    int arr[] = {15, 10, 20, 8, 12, 25, 6, 30, 1, 18};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    QuaternaryHeap demo;
+    QuaternaryHeapInit(&demo);
+    for (int i = 0; i < n; i++) {
+        QuaternaryHeapPush(&demo, arr[i]);
+    }
+    printf("4-ary heap after pushing ");
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n  Root:       %d\n", demo.data[0]);
+    printf("  Children:  ");
+    for (int i = 1; i <= 4; i++) {
+        printf(" %d", demo.data[i]);
+    }
+    printf("\n  Grandchildren of node 1:");
+    for (int i = 5; i <= 8; i++) {
+        printf(" %d", demo.data[i]);
+    }
+    printf("\n  Grandchildren of node 2:");
+    for (int i = 9; i <= 12; i++) {
+        if (demo.data[i] == EMPTY_KEY) {
+            printf(" -");
+        } else {
+            printf(" %d", demo.data[i]);
+        }
+    }
+    printf("\n  Child group of node 0 starts %zu bytes into a cache line\n",
+           (size_t)(uintptr_t)(demo.data + 1) % CACHE_LINE);
+    printf("  Valid: %s\n", QuaternaryHeapIsValid(&demo) ? "YES" : "NO");
+    printf("Pop all: ");
+    while (demo.size > 0) {
+        printf("%d ", QuaternaryHeapPop(&demo));
+    }
+    printf("\n");
+    QuaternaryHeapFree(&demo);
+
+    int maxElements = 10000000;
+    if (argc > 1) {
+        maxElements = atoi(argv[1]);
+    }
+    if (maxElements < 1000000 || maxElements > 200000000) {
+        printf("Usage: %s [maxElements 1000000-200000000]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (push n, n hold ops, pop n):\n");
+    printf("-------------------------------------------\n");
+#ifdef __AVX2__
+    printf("Smallest child: AVX2 for 8 and 16 children, conditional moves otherwise\n");
+#else
+    printf("Smallest child: conditional moves (compile with -mavx2 for SIMD)\n");
+#endif
+    for (long long size = 1000000; size <= maxElements; size *= 10) {
+        runBenchmark((int)size);
+    }
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
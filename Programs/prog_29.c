@@ -0,0 +1,670 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+
+#define INFINITE_DISTANCE LLONG_MAX
+
+// Weighted edge in an edge list
+typedef struct {
+    int src;
+    int dest;
+    int weight;
+} Edge;
+
+// Undirected weighted graph in compressed sparse row form
+typedef struct {
+    int numVertices;
+    long long numEdges;       // Adjacency entries (2 per undirected edge)
+    long long *rowOffsets;    // numVertices + 1 entries
+    int *neighbors;           // numEdges entries
+    int *weights;             // numEdges entries
+} CSRGraph;
+
+// Entry of a heap: a key and the id it belongs to
+typedef struct {
+    long long key;
+    int id;
+} HeapEntry;
+
+// Indexed min-priority queue over ids 0 .. capacity - 1. Besides the heap
+// of (key, id) entries, it keeps each id's heap position, so an element can
+// be found and its key changed or removed in O(log n). Keys live in the
+// entries, so sifting compares without an extra lookup.
+typedef struct {
+    int capacity;
+    int size;
+    HeapEntry *heap;
+    int *position;            // id -> heap slot, -1 if not queued
+} IndexedPQ;
+
+// Binary min-heap of entries for the lazy-deletion baseline; an entry may
+// be stale (its id was reached again with a smaller key)
+typedef struct {
+    HeapEntry *data;
+    int size;
+    int capacity;
+} LazyHeap;
+
+// Counters from one shortest-path run
+typedef struct {
+    double seconds;
+    long long pushes;         // Inserts (or lazy pushes)
+    long long decreases;      // Decrease-key calls
+    long long stalePops;      // Outdated lazy entries popped and skipped
+    int peakSize;             // Largest heap size
+} DijkstraStats;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== INDEXED PRIORITY QUEUE ====================
+
+IndexedPQ* createIndexedPQ(int capacity) {
+    IndexedPQ *pq = (IndexedPQ*)allocOrExit(sizeof(IndexedPQ));
+    pq->capacity = capacity;
+    pq->size = 0;
+    pq->heap = (HeapEntry*)allocOrExit(sizeof(HeapEntry) * capacity);
+    pq->position = (int*)allocOrExit(sizeof(int) * capacity);
+    for (int i = 0; i < capacity; i++) {
+        pq->position[i] = -1;
+    }
+    return pq;
+}
+
+void freeIndexedPQ(IndexedPQ *pq) {
+    free(pq->heap);
+    free(pq->position);
+    free(pq);
+}
+
+static inline bool validId(IndexedPQ *pq, int id) {
+    return id >= 0 && id < pq->capacity;
+}
+
+bool pqContains(IndexedPQ *pq, int id) {
+    return validId(pq, id) && pq->position[id] >= 0;
+}
+
+bool pqIsEmpty(IndexedPQ *pq) {
+    return pq->size == 0;
+}
+
+// Hole-based sifts: entries move into the hole and their ids' positions are
+// updated on every move, so position[] is always exact
+static void siftUp(IndexedPQ *pq, int slot, HeapEntry item) {
+    while (slot > 0) {
+        int parent = (slot - 1) / 2;
+        if (pq->heap[parent].key <= item.key) {
+            break;
+        }
+        pq->heap[slot] = pq->heap[parent];
+        pq->position[pq->heap[slot].id] = slot;
+        slot = parent;
+    }
+    pq->heap[slot] = item;
+    pq->position[item.id] = slot;
+}
+
+static void siftDown(IndexedPQ *pq, int slot, HeapEntry item) {
+    int child = 2 * slot + 1;
+    while (child < pq->size) {
+        if (child + 1 < pq->size) {
+            child += pq->heap[child + 1].key < pq->heap[child].key;
+        }
+        if (pq->heap[child].key >= item.key) {
+            break;
+        }
+        pq->heap[slot] = pq->heap[child];
+        pq->position[pq->heap[slot].id] = slot;
+        slot = child;
+        child = 2 * slot + 1;
+    }
+    pq->heap[slot] = item;
+    pq->position[item.id] = slot;
+}
+
+// Insert id with a key; fails if the id is invalid or already queued
+bool pqInsert(IndexedPQ *pq, int id, long long key) {
+    if (!validId(pq, id) || pq->position[id] >= 0) {
+        printf("Invalid or duplicate id %d!\n", id);
+        return false;
+    }
+    HeapEntry item = {key, id};
+    siftUp(pq, pq->size++, item);
+    return true;
+}
+
+// Id with the smallest key; the queue must not be empty
+int pqPeekId(IndexedPQ *pq) {
+    return pq->heap[0].id;
+}
+
+// Key of a queued id
+long long pqKeyOf(IndexedPQ *pq, int id) {
+    return pq->heap[pq->position[id]].key;
+}
+
+// Remove the entry at a heap slot, refilling the slot with the last entry
+static void removeSlot(IndexedPQ *pq, int slot) {
+    pq->position[pq->heap[slot].id] = -1;
+    HeapEntry last = pq->heap[--pq->size];
+    if (slot < pq->size) {
+        siftUp(pq, slot, last);
+        if (pq->position[last.id] == slot) {
+            siftDown(pq, slot, last);
+        }
+    }
+}
+
+// Remove and return the id with the smallest key; -1 if empty
+int pqPopMin(IndexedPQ *pq) {
+    if (pq->size == 0) {
+        return -1;
+    }
+    int id = pq->heap[0].id;
+    removeSlot(pq, 0);
+    return id;
+}
+
+// Lower an id's key: O(log n), sifts up only
+bool pqDecreaseKey(IndexedPQ *pq, int id, long long key) {
+    if (!pqContains(pq, id) || key > pqKeyOf(pq, id)) {
+        return false;
+    }
+    HeapEntry item = {key, id};
+    siftUp(pq, pq->position[id], item);
+    return true;
+}
+
+// Raise an id's key: O(log n), sifts down only
+bool pqIncreaseKey(IndexedPQ *pq, int id, long long key) {
+    if (!pqContains(pq, id) || key < pqKeyOf(pq, id)) {
+        return false;
+    }
+    HeapEntry item = {key, id};
+    siftDown(pq, pq->position[id], item);
+    return true;
+}
+
+// Remove an id wherever it is in the heap
+bool pqRemove(IndexedPQ *pq, int id) {
+    if (!pqContains(pq, id)) {
+        return false;
+    }
+    removeSlot(pq, pq->position[id]);
+    return true;
+}
+
+// Check heap order and that heap[] and position[] agree
+bool pqIsValid(IndexedPQ *pq) {
+    for (int slot = 0; slot < pq->size; slot++) {
+        if (pq->position[pq->heap[slot].id] != slot) {
+            return false;
+        }
+        if (slot > 0 && pq->heap[(slot - 1) / 2].key > pq->heap[slot].key) {
+            return false;
+        }
+    }
+    int queued = 0;
+    for (int id = 0; id < pq->capacity; id++) {
+        queued += pq->position[id] >= 0;
+    }
+    return queued == pq->size;
+}
+
+// ==================== LAZY-DELETION BASELINE ====================
+
+void lazyPush(LazyHeap *h, long long key, int id) {
+    if (h->size == h->capacity) {
+        h->capacity = h->capacity > 0 ? h->capacity * 2 : 1024;
+        h->data = (HeapEntry*)realloc(h->data, sizeof(HeapEntry) * h->capacity);
+        if (h->data == NULL) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+    }
+    int slot = h->size++;
+    while (slot > 0 && h->data[(slot - 1) / 2].key > key) {
+        h->data[slot] = h->data[(slot - 1) / 2];
+        slot = (slot - 1) / 2;
+    }
+    h->data[slot].key = key;
+    h->data[slot].id = id;
+}
+
+HeapEntry lazyPop(LazyHeap *h) {
+    HeapEntry top = h->data[0];
+    HeapEntry last = h->data[--h->size];
+    int slot = 0;
+    int child = 1;
+    while (child < h->size) {
+        if (child + 1 < h->size) {
+            child += h->data[child + 1].key < h->data[child].key;
+        }
+        if (h->data[child].key >= last.key) {
+            break;
+        }
+        h->data[slot] = h->data[child];
+        slot = child;
+        child = 2 * slot + 1;
+    }
+    h->data[slot] = last;
+    return top;
+}
+
+// ==================== GRAPHS ====================
+
+// Function to build an undirected weighted CSR graph; frees the edge list
+CSRGraph* buildCSR(int numVertices, Edge *edges, long long numEdges) {
+    CSRGraph *g = (CSRGraph*)allocOrExit(sizeof(CSRGraph));
+    g->numVertices = numVertices;
+    g->numEdges = 2 * numEdges;
+    g->rowOffsets = (long long*)calloc(numVertices + 1, sizeof(long long));
+    g->neighbors = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+    g->weights = (int*)allocOrExit(sizeof(int) * (g->numEdges + 1));
+    long long *cursor = (long long*)allocOrExit(sizeof(long long) * (numVertices + 1));
+    if (g->rowOffsets == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (long long e = 0; e < numEdges; e++) {
+        g->rowOffsets[edges[e].src + 1]++;
+        g->rowOffsets[edges[e].dest + 1]++;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        g->rowOffsets[v + 1] += g->rowOffsets[v];
+    }
+    memcpy(cursor, g->rowOffsets, sizeof(long long) * (numVertices + 1));
+    for (long long e = 0; e < numEdges; e++) {
+        long long a = cursor[edges[e].src]++;
+        long long b = cursor[edges[e].dest]++;
+        g->neighbors[a] = edges[e].dest;
+        g->weights[a] = edges[e].weight;
+        g->neighbors[b] = edges[e].src;
+        g->weights[b] = edges[e].weight;
+    }
+    free(cursor);
+    free(edges);
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g->weights);
+    free(g);
+}
+
+// Road-like graph: a rows x cols grid with random travel times
+CSRGraph* generateRoadGrid(int rows, int cols, int maxWeight, uint64_t seed) {
+    long long m = (long long)rows * (cols - 1) + (long long)(rows - 1) * cols;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * m);
+    uint64_t state = seed;
+    long long e = 0;
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int v = r * cols + c;
+            if (c + 1 < cols) {
+                edges[e].src = v;
+                edges[e].dest = v + 1;
+                edges[e++].weight = 1 + nextRandom(&state) % maxWeight;
+            }
+            if (r + 1 < rows) {
+                edges[e].src = v;
+                edges[e].dest = v + cols;
+                edges[e++].weight = 1 + nextRandom(&state) % maxWeight;
+            }
+        }
+    }
+    return buildCSR(rows * cols, edges, m);
+}
+
+// Social-network-like graph: R-MAT (see Program 22) with random weights
+CSRGraph* generateWeightedRMAT(int scale, int edgeFactor, int maxWeight, uint64_t seed) {
+    const double a = 0.57, b = 0.19, c = 0.19;
+    int n = 1 << scale;
+    long long m = (long long)edgeFactor * n;
+    Edge *edges = (Edge*)allocOrExit(sizeof(Edge) * m);
+    uint64_t state = seed;
+    for (long long e = 0; e < m; e++) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0);
+            if (r >= a && r < a + b) {
+                v |= 1 << bit;
+            } else if (r >= a + b && r < a + b + c) {
+                u |= 1 << bit;
+            } else if (r >= a + b + c) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        edges[e].src = u;
+        edges[e].dest = v;
+        edges[e].weight = 1 + nextRandom(&state) % maxWeight;
+    }
+    return buildCSR(n, edges, m);
+}
+
+// ==================== DIJKSTRA ====================
+
+// Dijkstra with decrease-key: every vertex is in the queue at most once
+void dijkstraIndexed(CSRGraph *g, int source, long long *distance, DijkstraStats *stats) {
+    int n = g->numVertices;
+    IndexedPQ *pq = createIndexedPQ(n);
+    memset(stats, 0, sizeof(*stats));
+    double start = getTimeSeconds();
+
+    for (int v = 0; v < n; v++) {
+        distance[v] = INFINITE_DISTANCE;
+    }
+    distance[source] = 0;
+    pqInsert(pq, source, 0);
+    stats->pushes = 1;
+    while (!pqIsEmpty(pq)) {
+        int u = pqPopMin(pq);
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            long long candidate = distance[u] + g->weights[k];
+            if (candidate < distance[v]) {
+                if (distance[v] == INFINITE_DISTANCE) {
+                    pqInsert(pq, v, candidate);
+                    stats->pushes++;
+                } else {
+                    pqDecreaseKey(pq, v, candidate);
+                    stats->decreases++;
+                }
+                distance[v] = candidate;
+                if (pq->size > stats->peakSize) {
+                    stats->peakSize = pq->size;
+                }
+            }
+        }
+    }
+
+    stats->seconds = getTimeSeconds() - start;
+    freeIndexedPQ(pq);
+}
+
+// Dijkstra with lazy deletion: an improved distance pushes a duplicate,
+// and outdated entries are skipped when popped
+void dijkstraLazy(CSRGraph *g, int source, long long *distance, DijkstraStats *stats) {
+    int n = g->numVertices;
+    LazyHeap heap = {NULL, 0, 0};
+    memset(stats, 0, sizeof(*stats));
+    double start = getTimeSeconds();
+
+    for (int v = 0; v < n; v++) {
+        distance[v] = INFINITE_DISTANCE;
+    }
+    distance[source] = 0;
+    lazyPush(&heap, 0, source);
+    stats->pushes = 1;
+    while (heap.size > 0) {
+        HeapEntry top = lazyPop(&heap);
+        int u = top.id;
+        if (top.key > distance[u]) {
+            stats->stalePops++;
+            continue;
+        }
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            long long candidate = distance[u] + g->weights[k];
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                lazyPush(&heap, candidate, v);
+                stats->pushes++;
+                if (heap.size > stats->peakSize) {
+                    stats->peakSize = heap.size;
+                }
+            }
+        }
+    }
+
+    stats->seconds = getTimeSeconds() - start;
+    free(heap.data);
+}
+
+// ==================== PRIM ====================
+
+// Prim's minimum spanning tree of the component containing 'root', with
+// decrease-key on the cheapest known connection of each vertex
+long long primIndexed(CSRGraph *g, int root, DijkstraStats *stats) {
+    int n = g->numVertices;
+    IndexedPQ *pq = createIndexedPQ(n);
+    long long *cost = (long long*)allocOrExit(sizeof(long long) * n);
+    bool *inTree = (bool*)allocOrExit(sizeof(bool) * n);
+    long long total = 0;
+    memset(stats, 0, sizeof(*stats));
+    double start = getTimeSeconds();
+
+    for (int v = 0; v < n; v++) {
+        cost[v] = INFINITE_DISTANCE;
+        inTree[v] = false;
+    }
+    cost[root] = 0;
+    pqInsert(pq, root, 0);
+    stats->pushes = 1;
+    while (!pqIsEmpty(pq)) {
+        int u = pqPopMin(pq);
+        inTree[u] = true;
+        total += cost[u];
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            if (!inTree[v] && g->weights[k] < cost[v]) {
+                if (cost[v] == INFINITE_DISTANCE) {
+                    pqInsert(pq, v, g->weights[k]);
+                    stats->pushes++;
+                } else {
+                    pqDecreaseKey(pq, v, g->weights[k]);
+                    stats->decreases++;
+                }
+                cost[v] = g->weights[k];
+                if (pq->size > stats->peakSize) {
+                    stats->peakSize = pq->size;
+                }
+            }
+        }
+    }
+
+    stats->seconds = getTimeSeconds() - start;
+    freeIndexedPQ(pq);
+    free(cost);
+    free(inTree);
+    return total;
+}
+
+// Prim's algorithm with lazy deletion: entries for vertices already in the
+// tree are skipped when popped
+long long primLazy(CSRGraph *g, int root, DijkstraStats *stats) {
+    int n = g->numVertices;
+    LazyHeap heap = {NULL, 0, 0};
+    long long *cost = (long long*)allocOrExit(sizeof(long long) * n);
+    bool *inTree = (bool*)allocOrExit(sizeof(bool) * n);
+    long long total = 0;
+    memset(stats, 0, sizeof(*stats));
+    double start = getTimeSeconds();
+
+    for (int v = 0; v < n; v++) {
+        cost[v] = INFINITE_DISTANCE;
+        inTree[v] = false;
+    }
+    cost[root] = 0;
+    lazyPush(&heap, 0, root);
+    stats->pushes = 1;
+    while (heap.size > 0) {
+        HeapEntry top = lazyPop(&heap);
+        int u = top.id;
+        if (inTree[u]) {
+            stats->stalePops++;
+            continue;
+        }
+        inTree[u] = true;
+        total += top.key;
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {
+            int v = g->neighbors[k];
+            if (!inTree[v] && g->weights[k] < cost[v]) {
+                cost[v] = g->weights[k];
+                lazyPush(&heap, cost[v], v);
+                stats->pushes++;
+                if (heap.size > stats->peakSize) {
+                    stats->peakSize = heap.size;
+                }
+            }
+        }
+    }
+
+    stats->seconds = getTimeSeconds() - start;
+    free(heap.data);
+    free(cost);
+    free(inTree);
+    return total;
+}
+
+void runBenchmark(const char *name, CSRGraph *g, int numSources) {
+    int n = g->numVertices;
+    long long *distance = (long long*)allocOrExit(sizeof(long long) * n);
+    long long *reference = (long long*)allocOrExit(sizeof(long long) * n);
+    DijkstraStats indexed = {0};
+    DijkstraStats lazy = {0};
+    DijkstraStats run;
+    bool same = true;
+    uint64_t state = 77;
+
+    for (int s = 0; s < numSources; s++) {
+        int source = nextRandom(&state) % n;
+        dijkstraIndexed(g, source, reference, &run);
+        indexed.seconds += run.seconds;
+        indexed.pushes += run.pushes;
+        indexed.decreases += run.decreases;
+        indexed.peakSize = run.peakSize > indexed.peakSize ? run.peakSize : indexed.peakSize;
+
+        dijkstraLazy(g, source, distance, &run);
+        lazy.seconds += run.seconds;
+        lazy.pushes += run.pushes;
+        lazy.stalePops += run.stalePops;
+        lazy.peakSize = run.peakSize > lazy.peakSize ? run.peakSize : lazy.peakSize;
+
+        same &= memcmp(distance, reference, sizeof(long long) * n) == 0;
+    }
+
+    // Heap memory: indexed = one entry and one position per vertex; lazy = entries
+    double indexedMB = (double)n * (sizeof(HeapEntry) + sizeof(int)) / 1048576;
+    double lazyMB = (double)lazy.peakSize * sizeof(HeapEntry) / 1048576;
+
+    printf("\n%s: %d vertices, %lld adjacency entries, %d sources\n", name, n, g->numEdges, numSources);
+    printf("%-15s %9s %12s %12s %12s %10s %9s\n", "Queue", "ms/run", "Pushes/run", "Decr/run",
+           "Stale/run", "Peak size", "Peak MB");
+    printf("-----------------------------------------------------------------------------------\n");
+    printf("%-15s %9.1f %12lld %12lld %12s %10d %9.1f\n", "Indexed (d-k)", indexed.seconds / numSources * 1000,
+           indexed.pushes / numSources, indexed.decreases / numSources, "-", indexed.peakSize, indexedMB);
+    printf("%-15s %9.1f %12lld %12s %12lld %10d %9.1f\n", "Lazy deletion", lazy.seconds / numSources * 1000,
+           lazy.pushes / numSources, "-", lazy.stalePops / numSources, lazy.peakSize, lazyMB);
+    printf("Peak heap entries, lazy / indexed: %.2fx; time, lazy / indexed: %.2fx; same distances: %s\n",
+           (double)lazy.peakSize / indexed.peakSize, lazy.seconds / indexed.seconds, same ? "yes" : "NO");
+
+    DijkstraStats primIdx;
+    DijkstraStats primLz;
+    long long treeIndexed = primIndexed(g, 0, &primIdx);
+    long long treeLazy = primLazy(g, 0, &primLz);
+    printf("Prim from vertex 0: indexed %.1f ms (peak %d), lazy %.1f ms (peak %d, %lld stale pops), "
+           "tree weight %lld %s\n", primIdx.seconds * 1000, primIdx.peakSize, primLz.seconds * 1000,
+           primLz.peakSize, primLz.stalePops, treeIndexed, treeIndexed == treeLazy ? "(same)" : "(DIFFERENT)");
+
+    free(distance);
+    free(reference);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  INDEXED PRIORITY QUEUE\n");
+    printf("  Decrease-Key, Remove and Contains by Id\n");
+    printf("=========================================\n\n");
+
+    // Basic operations on ids 0..7
+    IndexedPQ *pq = createIndexedPQ(8);
+    long long initial[] = {50, 30, 70, 10, 90, 60};
+    for (int id = 0; id < 6; id++) {
+        pqInsert(pq, id, initial[id]);
+    }
+    printf("Inserted ids 0-5 with keys 50 30 70 10 90 60\n");
+    printf("Min: id %d (key %lld)\n", pqPeekId(pq), pqKeyOf(pq, pqPeekId(pq)));
+    pqDecreaseKey(pq, 4, 5);
+    printf("decreaseKey(4, 5)   -> min: id %d (key %lld)\n", pqPeekId(pq), pqKeyOf(pq, pqPeekId(pq)));
+    pqIncreaseKey(pq, 4, 65);
+    printf("increaseKey(4, 65)  -> min: id %d (key %lld)\n", pqPeekId(pq), pqKeyOf(pq, pqPeekId(pq)));
+    pqRemove(pq, 3);
+    printf("remove(3)           -> min: id %d (key %lld), contains(3): %s\n", pqPeekId(pq),
+           pqKeyOf(pq, pqPeekId(pq)), pqContains(pq, 3) ? "yes" : "no");
+    printf("decreaseKey(3, 1) on a removed id: %s\n", pqDecreaseKey(pq, 3, 1) ? "applied" : "rejected");
+    printf("insert(2, 1) on a queued id: ");
+    pqInsert(pq, 2, 1);
+    printf("Heap valid: %s\n", pqIsValid(pq) ? "YES" : "NO");
+    printf("Pop order: ");
+    while (!pqIsEmpty(pq)) {
+        int id = pqPeekId(pq);
+        printf("%d(%lld) ", id, pqKeyOf(pq, id));
+        pqPopMin(pq);
+    }
+    printf("\n");
+    freeIndexedPQ(pq);
+
+    int side = 1000;
+    int scale = 18;
+    int numSources = 5;
+    if (argc > 1) {
+        side = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        scale = atoi(argv[2]);
+    }
+    if (side < 2 || scale < 4 || scale > 26) {
+        printf("Usage: %s [gridSide] [rmatScale 4-26]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Dijkstra and Prim: decrease-key vs lazy deletion\n");
+    printf("-------------------------------------------");
+
+    char name[64];
+    CSRGraph *g = generateRoadGrid(side, side, 1000, 3);
+    snprintf(name, sizeof(name), "Road-like %dx%d grid", side, side);
+    runBenchmark(name, g, numSources);
+    freeCSR(g);
+
+    g = generateWeightedRMAT(scale, 16, 1000, 5);
+    snprintf(name, sizeof(name), "R-MAT scale %d", scale);
+    runBenchmark(name, g, numSources);
+    freeCSR(g);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,587 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define INITIAL_CAPACITY 1024
+
+// Min-max heap: a complete binary tree in one array whose levels alternate.
+// Nodes on even levels (0, 2, ...) are the smallest of their subtree, nodes
+// on odd levels the largest. The minimum is the root and the maximum is one
+// of its two children.
+typedef struct {
+    int *data;
+    int size;
+    int capacity;
+} MinMaxHeap;
+
+// Entry of the two-heap baseline; 'id' identifies the element in both heaps
+typedef struct {
+    int key;
+    int id;
+} Entry;
+
+// Binary heap of entries (min or max order)
+typedef struct {
+    Entry *data;
+    int size;
+    int capacity;
+} EntryHeap;
+
+// Baseline double-ended queue: a MinHeap and a MaxHeap holding the same
+// elements, as in Program 6. Extracting from one heap leaves a stale copy
+// in the other, which is skipped later (lazy deletion).
+typedef struct {
+    EntryHeap minHeap;
+    EntryHeap maxHeap;
+    bool *removed;            // id -> already extracted
+    int idCapacity;
+    int nextId;
+    int size;                 // Live elements
+} TwoHeaps;
+
+// Timings of one implementation
+typedef struct {
+    double buildNs;           // Per element
+    double mixedNs;           // Per push + extract pair
+    double drainNs;           // Per extract
+    uint64_t checksum;        // Hash of the extracted sequence
+    long long peakBytes;
+} DequeResult;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* reallocOrExit(void *memory, size_t bytes) {
+    memory = realloc(memory, bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== MIN-MAX HEAP ====================
+
+// Level of index i is floor(log2(i + 1)); even levels are min levels
+static inline bool isMinLevel(int i) {
+    return ((31 - __builtin_clz((unsigned)i + 1)) & 1) == 0;
+}
+
+void initMinMaxHeap(MinMaxHeap *h, int capacity) {
+    h->capacity = capacity > 0 ? capacity : INITIAL_CAPACITY;
+    h->data = (int*)reallocOrExit(NULL, sizeof(int) * h->capacity);
+    h->size = 0;
+}
+
+void freeMinMaxHeap(MinMaxHeap *h) {
+    free(h->data);
+}
+
+// Move 'key' up from the hole at 'index' through grandparents on min levels
+static void bubbleUpMin(MinMaxHeap *h, int index, int key) {
+    while (index > 2) {
+        int grandparent = (index - 3) / 4;
+        if (h->data[grandparent] <= key) {
+            break;
+        }
+        h->data[index] = h->data[grandparent];
+        index = grandparent;
+    }
+    h->data[index] = key;
+}
+
+// Same through grandparents on max levels
+static void bubbleUpMax(MinMaxHeap *h, int index, int key) {
+    while (index > 2) {
+        int grandparent = (index - 3) / 4;
+        if (h->data[grandparent] >= key) {
+            break;
+        }
+        h->data[index] = h->data[grandparent];
+        index = grandparent;
+    }
+    h->data[index] = key;
+}
+
+// Function to insert: compare with the parent once to pick the min or max
+// chain, then climb that chain two levels at a time
+void pushMinMax(MinMaxHeap *h, int key) {
+    if (h->size == h->capacity) {
+        h->capacity *= 2;
+        h->data = (int*)reallocOrExit(h->data, sizeof(int) * h->capacity);
+    }
+    int index = h->size++;
+    if (index == 0) {
+        h->data[0] = key;
+        return;
+    }
+    int parent = (index - 1) / 2;
+    if (isMinLevel(index)) {
+        if (key > h->data[parent]) {
+            h->data[index] = h->data[parent];
+            bubbleUpMax(h, parent, key);
+        } else {
+            bubbleUpMin(h, index, key);
+        }
+    } else {
+        if (key < h->data[parent]) {
+            h->data[index] = h->data[parent];
+            bubbleUpMin(h, parent, key);
+        } else {
+            bubbleUpMax(h, index, key);
+        }
+    }
+}
+
+// Place 'key' into the hole at min-level 'index': the hole moves to the
+// smallest child or grandchild while that is smaller than the key. After a
+// grandchild step, the key may be larger than the max-level node between
+// them; the two are exchanged and the descent continues with the smaller one.
+static void trickleDownMin(MinMaxHeap *h, int index, int key) {
+    int *a = h->data;
+    int size = h->size;
+    while (2 * index + 1 < size) {
+        int grandchild = 4 * index + 3;
+        int best;
+        if (grandchild + 3 < size) {
+            // Common case: both children have children of their own, so the
+            // smallest is among the 4 grandchildren (a pairwise tournament)
+            int left = a[grandchild + 1] < a[grandchild] ? grandchild + 1 : grandchild;
+            int right = a[grandchild + 3] < a[grandchild + 2] ? grandchild + 3 : grandchild + 2;
+            best = a[right] < a[left] ? right : left;
+        } else {
+            int first = 2 * index + 1;
+            best = first;
+            if (first + 1 < size && a[first + 1] < a[best]) {
+                best = first + 1;
+            }
+            for (int g = grandchild; g < size; g++) {
+                best = a[g] < a[best] ? g : best;
+            }
+        }
+        if (a[best] >= key) {
+            break;
+        }
+        a[index] = a[best];
+        index = best;
+        if (best < grandchild) {
+            break;
+        }
+        int parent = (best - 1) / 2;
+        if (key > a[parent]) {
+            int larger = a[parent];
+            a[parent] = key;
+            key = larger;
+        }
+    }
+    a[index] = key;
+}
+
+// Mirror image for max levels
+static void trickleDownMax(MinMaxHeap *h, int index, int key) {
+    int *a = h->data;
+    int size = h->size;
+    while (2 * index + 1 < size) {
+        int grandchild = 4 * index + 3;
+        int best;
+        if (grandchild + 3 < size) {
+            // Largest among the 4 grandchildren
+            int left = a[grandchild + 1] > a[grandchild] ? grandchild + 1 : grandchild;
+            int right = a[grandchild + 3] > a[grandchild + 2] ? grandchild + 3 : grandchild + 2;
+            best = a[right] > a[left] ? right : left;
+        } else {
+            int first = 2 * index + 1;
+            best = first;
+            if (first + 1 < size && a[first + 1] > a[best]) {
+                best = first + 1;
+            }
+            for (int g = grandchild; g < size; g++) {
+                best = a[g] > a[best] ? g : best;
+            }
+        }
+        if (a[best] <= key) {
+            break;
+        }
+        a[index] = a[best];
+        index = best;
+        if (best < grandchild) {
+            break;
+        }
+        int parent = (best - 1) / 2;
+        if (key < a[parent]) {
+            int smaller = a[parent];
+            a[parent] = key;
+            key = smaller;
+        }
+    }
+    a[index] = key;
+}
+
+// Index of the maximum: the root if alone, else the larger root child
+static inline int maxIndex(MinMaxHeap *h) {
+    if (h->size <= 2) {
+        return h->size - 1;
+    }
+    return h->data[1] >= h->data[2] ? 1 : 2;
+}
+
+int findMin(MinMaxHeap *h) {
+    return h->data[0];
+}
+
+int findMax(MinMaxHeap *h) {
+    return h->data[maxIndex(h)];
+}
+
+// Function to remove the minimum (heap must not be empty)
+int popMin(MinMaxHeap *h) {
+    int top = h->data[0];
+    int last = h->data[--h->size];
+    if (h->size > 0) {
+        trickleDownMin(h, 0, last);
+    }
+    return top;
+}
+
+// Function to remove the maximum (heap must not be empty)
+int popMax(MinMaxHeap *h) {
+    int index = maxIndex(h);
+    int top = h->data[index];
+    int last = h->data[--h->size];
+    if (index < h->size) {
+        if (index == 0) {
+            trickleDownMin(h, 0, last);
+        } else {
+            trickleDownMax(h, index, last);
+        }
+    }
+    return top;
+}
+
+// Function to build in O(n): Floyd's method, trickling down every internal
+// node from the last one to the root with the rule of its level
+void buildMinMaxHeap(MinMaxHeap *h, const int *items, int n) {
+    if (n > h->capacity) {
+        h->capacity = n;
+        h->data = (int*)reallocOrExit(h->data, sizeof(int) * h->capacity);
+    }
+    memcpy(h->data, items, sizeof(int) * n);
+    h->size = n;
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        if (isMinLevel(i)) {
+            trickleDownMin(h, i, h->data[i]);
+        } else {
+            trickleDownMax(h, i, h->data[i]);
+        }
+    }
+}
+
+// Check that every node is <= (min level) or >= (max level) its descendants;
+// comparing each node with its parent and grandparent is sufficient
+bool verifyMinMaxHeap(MinMaxHeap *h) {
+    for (int i = 1; i < h->size; i++) {
+        int parent = (i - 1) / 2;
+        if (isMinLevel(parent) ? h->data[i] < h->data[parent] : h->data[i] > h->data[parent]) {
+            return false;
+        }
+        if (i > 2) {
+            // The grandparent is on the same kind of level as i
+            int grandparent = (parent - 1) / 2;
+            if (isMinLevel(i) ? h->data[i] < h->data[grandparent] : h->data[i] > h->data[grandparent]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ==================== TWO-HEAP BASELINE ====================
+
+// Entry order: BEFORE_MIN for the min heap, BEFORE_MAX for the max heap
+#define BEFORE_MIN(a, b) ((a).key < (b).key)
+#define BEFORE_MAX(a, b) ((a).key > (b).key)
+
+#define DEFINE_ENTRY_HEAP_OPS(Prefix, BEFORE)                                       \
+static void Prefix##Push(EntryHeap *h, Entry item) {                                \
+    if (h->size == h->capacity) {                                                   \
+        h->capacity = h->capacity > 0 ? h->capacity * 2 : INITIAL_CAPACITY;         \
+        h->data = (Entry*)reallocOrExit(h->data, sizeof(Entry) * h->capacity);      \
+    }                                                                               \
+    int index = h->size++;                                                          \
+    while (index > 0 && BEFORE(item, h->data[(index - 1) / 2])) {                   \
+        h->data[index] = h->data[(index - 1) / 2];                                  \
+        index = (index - 1) / 2;                                                    \
+    }                                                                               \
+    h->data[index] = item;                                                          \
+}                                                                                   \
+                                                                                    \
+static void Prefix##SiftDown(EntryHeap *h, int index, Entry item) {                 \
+    int child = 2 * index + 1;                                                      \
+    while (child < h->size) {                                                       \
+        if (child + 1 < h->size) {                                                  \
+            child += BEFORE(h->data[child + 1], h->data[child]);                    \
+        }                                                                           \
+        if (!BEFORE(h->data[child], item)) {                                        \
+            break;                                                                  \
+        }                                                                           \
+        h->data[index] = h->data[child];                                            \
+        index = child;                                                              \
+        child = 2 * index + 1;                                                      \
+    }                                                                               \
+    h->data[index] = item;                                                          \
+}                                                                                   \
+                                                                                    \
+static Entry Prefix##Pop(EntryHeap *h) {                                            \
+    Entry top = h->data[0];                                                         \
+    Entry last = h->data[--h->size];                                                \
+    if (h->size > 0) {                                                              \
+        Prefix##SiftDown(h, 0, last);                                               \
+    }                                                                               \
+    return top;                                                                     \
+}                                                                                   \
+                                                                                    \
+static void Prefix##Heapify(EntryHeap *h) {                                         \
+    for (int i = h->size / 2 - 1; i >= 0; i--) {                                    \
+        Prefix##SiftDown(h, i, h->data[i]);                                         \
+    }                                                                               \
+}
+
+DEFINE_ENTRY_HEAP_OPS(minEntry, BEFORE_MIN)
+DEFINE_ENTRY_HEAP_OPS(maxEntry, BEFORE_MAX)
+
+void initTwoHeaps(TwoHeaps *t) {
+    memset(t, 0, sizeof(*t));
+}
+
+void freeTwoHeaps(TwoHeaps *t) {
+    free(t->minHeap.data);
+    free(t->maxHeap.data);
+    free(t->removed);
+}
+
+static int newId(TwoHeaps *t) {
+    if (t->nextId == t->idCapacity) {
+        t->idCapacity = t->idCapacity > 0 ? t->idCapacity * 2 : INITIAL_CAPACITY;
+        t->removed = (bool*)reallocOrExit(t->removed, sizeof(bool) * t->idCapacity);
+    }
+    t->removed[t->nextId] = false;
+    return t->nextId++;
+}
+
+void pushTwoHeaps(TwoHeaps *t, int key) {
+    Entry e = {key, newId(t)};
+    minEntryPush(&t->minHeap, e);
+    maxEntryPush(&t->maxHeap, e);
+    t->size++;
+}
+
+// Build both heaps from an array (Program 6 builds them separately, too)
+void buildTwoHeaps(TwoHeaps *t, const int *items, int n) {
+    t->minHeap.data = (Entry*)reallocOrExit(t->minHeap.data, sizeof(Entry) * n);
+    t->maxHeap.data = (Entry*)reallocOrExit(t->maxHeap.data, sizeof(Entry) * n);
+    t->minHeap.capacity = t->maxHeap.capacity = n;
+    for (int i = 0; i < n; i++) {
+        Entry e = {items[i], newId(t)};
+        t->minHeap.data[i] = e;
+        t->maxHeap.data[i] = e;
+    }
+    t->minHeap.size = t->maxHeap.size = t->size = n;
+    minEntryHeapify(&t->minHeap);
+    maxEntryHeapify(&t->maxHeap);
+}
+
+int popMinTwoHeaps(TwoHeaps *t) {
+    Entry e = minEntryPop(&t->minHeap);
+    while (t->removed[e.id]) {
+        e = minEntryPop(&t->minHeap);
+    }
+    t->removed[e.id] = true;
+    t->size--;
+    return e.key;
+}
+
+int popMaxTwoHeaps(TwoHeaps *t) {
+    Entry e = maxEntryPop(&t->maxHeap);
+    while (t->removed[e.id]) {
+        e = maxEntryPop(&t->maxHeap);
+    }
+    t->removed[e.id] = true;
+    t->size--;
+    return e.key;
+}
+
+static long long twoHeapsBytes(TwoHeaps *t) {
+    return (long long)(t->minHeap.capacity + t->maxHeap.capacity) * sizeof(Entry) +
+           (long long)t->idCapacity * sizeof(bool);
+}
+
+// ==================== BENCHMARK ====================
+
+static inline uint64_t mixHash(uint64_t hash, int value) {
+    return (hash ^ (uint32_t)value) * 1099511628211ULL;
+}
+
+// Same workload for both: build n keys, then n rounds of push + extract
+// (alternating min and max, a bounded buffer that evicts both ends), then
+// drain alternately from both ends
+void runMinMax(const int *keys, const int *extra, int n, DequeResult *r) {
+    MinMaxHeap h;
+    initMinMaxHeap(&h, 0);
+    uint64_t hash = 14695981039346656037ULL;
+
+    double start = getTimeSeconds();
+    buildMinMaxHeap(&h, keys, n);
+    r->buildNs = (getTimeSeconds() - start) / n * 1e9;
+
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        pushMinMax(&h, extra[i]);
+        hash = mixHash(hash, (i & 1) ? popMax(&h) : popMin(&h));
+    }
+    r->mixedNs = (getTimeSeconds() - start) / n * 1e9;
+    r->peakBytes = (long long)h.capacity * sizeof(int);
+
+    start = getTimeSeconds();
+    for (int i = 0; h.size > 0; i++) {
+        hash = mixHash(hash, (i & 1) ? popMax(&h) : popMin(&h));
+    }
+    r->drainNs = (getTimeSeconds() - start) / n * 1e9;
+    r->checksum = hash;
+    freeMinMaxHeap(&h);
+}
+
+void runTwoHeaps(const int *keys, const int *extra, int n, DequeResult *r) {
+    TwoHeaps t;
+    initTwoHeaps(&t);
+    uint64_t hash = 14695981039346656037ULL;
+
+    double start = getTimeSeconds();
+    buildTwoHeaps(&t, keys, n);
+    r->buildNs = (getTimeSeconds() - start) / n * 1e9;
+
+    start = getTimeSeconds();
+    for (int i = 0; i < n; i++) {
+        pushTwoHeaps(&t, extra[i]);
+        hash = mixHash(hash, (i & 1) ? popMaxTwoHeaps(&t) : popMinTwoHeaps(&t));
+    }
+    r->mixedNs = (getTimeSeconds() - start) / n * 1e9;
+    r->peakBytes = twoHeapsBytes(&t);
+
+    start = getTimeSeconds();
+    for (int i = 0; t.size > 0; i++) {
+        hash = mixHash(hash, (i & 1) ? popMaxTwoHeaps(&t) : popMinTwoHeaps(&t));
+    }
+    r->drainNs = (getTimeSeconds() - start) / n * 1e9;
+    r->checksum = hash;
+    freeTwoHeaps(&t);
+}
+
+void runBenchmark(int n) {
+    int *keys = (int*)reallocOrExit(NULL, sizeof(int) * n);
+    int *extra = (int*)reallocOrExit(NULL, sizeof(int) * n);
+    uint64_t state = 2024;
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(nextRandom(&state) >> 33);
+        extra[i] = (int)(nextRandom(&state) >> 33);
+    }
+
+    DequeResult single;
+    DequeResult pair;
+    runMinMax(keys, extra, n, &single);
+    runTwoHeaps(keys, extra, n, &pair);
+
+    printf("\n%d elements\n", n);
+    printf("%-16s %10s %12s %10s %10s\n", "Implementation", "Build ns", "Push+pop ns", "Pop ns", "Peak MB");
+    printf("------------------------------------------------------------\n");
+    printf("%-16s %10.1f %12.1f %10.1f %10.1f\n", "Two heaps", pair.buildNs, pair.mixedNs, pair.drainNs,
+           pair.peakBytes / 1048576.0);
+    printf("%-16s %10.1f %12.1f %10.1f %10.1f\n", "Min-max heap", single.buildNs, single.mixedNs,
+           single.drainNs, single.peakBytes / 1048576.0);
+    printf("Speedup: build %.2fx, push+pop %.2fx, pop %.2fx; same output: %s\n",
+           pair.buildNs / single.buildNs, pair.mixedNs / single.mixedNs, pair.drainNs / single.drainNs,
+           pair.checksum == single.checksum ? "yes" : "NO");
+
+    free(keys);
+    free(extra);
+}
+
+// Function to display the tree level by level, marking min and max levels
+void displayLevels(MinMaxHeap *h) {
+    for (int level = 0, start = 0; start < h->size; level++, start = 2 * start + 1) {
+        int end = 2 * start + 1 < h->size ? 2 * start + 1 : h->size;
+        printf("  Level %d (%s): ", level, level % 2 == 0 ? "min" : "max");
+        for (int i = start; i < end; i++) {
+            printf("%d ", h->data[i]);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  MIN-MAX HEAP\n");
+    printf("  Double-Ended Priority Queue\n");
+    printf("=========================================\n\n");
+
+    // The array of Program 6's first test case
+    int arr[] = {15, 10, 20, 8, 12, 25, 6};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    MinMaxHeap h;
+    initMinMaxHeap(&h, 4);
+
+    printf("Original Array: ");
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n\nBuilt in O(n):\n");
+    buildMinMaxHeap(&h, arr, n);
+    displayLevels(&h);
+    printf("Min: %d, Max: %d, Valid: %s\n", findMin(&h), findMax(&h), verifyMinMaxHeap(&h) ? "YES" : "NO");
+
+    pushMinMax(&h, 30);
+    pushMinMax(&h, 1);
+    printf("\nAfter pushing 30 and 1:\n");
+    displayLevels(&h);
+    printf("Min: %d, Max: %d, Valid: %s\n", findMin(&h), findMax(&h), verifyMinMaxHeap(&h) ? "YES" : "NO");
+
+    printf("\nAlternate popMin / popMax: ");
+    for (int i = 0; h.size > 0; i++) {
+        printf("%d ", (i & 1) ? popMax(&h) : popMin(&h));
+    }
+    printf("\n");
+    freeMinMaxHeap(&h);
+
+    int maxElements = 10000000;
+    if (argc > 1) {
+        maxElements = atoi(argv[1]);
+        if (maxElements < 1000 || maxElements > 200000000) {
+            printf("Usage: %s [maxElements 1000-200000000]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (random ints, time per operation):\n");
+    printf("-------------------------------------------");
+    for (int size = maxElements < 1000000 ? maxElements : 1000000; size <= maxElements; size *= 10) {
+        runBenchmark(size);
+    }
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,543 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#define MAX_THREADS 64
+#define CHUNK_BYTES (1 << 20)     // Bytes handed to a worker at a time
+#define QUEUE_SLOTS 8             // Chunks buffered between reader and workers
+#define SHOW_TOP 10
+
+// Bounded min-heap holding the K largest values seen so far. The root is the
+// smallest of them, the threshold a new value must beat to enter.
+typedef struct {
+    long long *data;
+    int size;
+    int k;
+} TopKHeap;
+
+// A block of input text; ends on a token boundary
+typedef struct {
+    char *text;
+    size_t length;
+} Chunk;
+
+// Bounded queue of chunks from the reader to the workers
+typedef struct {
+    Chunk slots[QUEUE_SLOTS];
+    int head;
+    int count;
+    bool done;                // Reader reached end of input
+    pthread_mutex_t lock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+} ChunkQueue;
+
+// One worker thread: its own heap, so workers never share state
+typedef struct {
+    pthread_t thread;
+    ChunkQueue *queue;
+    TopKHeap heap;
+    long long count;          // Integers parsed
+    long long rejected;       // Tokens too large for a long long
+    const long long *values;  // In-memory mode: a slice of an array
+    long long numValues;
+} Worker;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== BOUNDED TOP-K HEAP ====================
+
+void initTopK(TopKHeap *h, int k) {
+    h->data = (long long*)allocOrExit(sizeof(long long) * k);
+    h->size = 0;
+    h->k = k;
+}
+
+void freeTopK(TopKHeap *h) {
+    free(h->data);
+}
+
+// Hole-based sift-down from the root (see Program 27)
+static void siftDownTopK(TopKHeap *h, long long value) {
+    long long *a = h->data;
+    int size = h->size;
+    int index = 0;
+    int child = 1;
+    while (child < size) {
+        if (child + 1 < size) {
+            child += a[child + 1] < a[child];
+        }
+        if (a[child] >= value) {
+            break;
+        }
+        a[index] = a[child];
+        index = child;
+        child = 2 * index + 1;
+    }
+    a[index] = value;
+}
+
+// Function to offer a value: fills the heap up to K, then replaces the root
+// whenever the value beats it. Once the heap is full, almost every value
+// fails the single comparison with the root, so the common case is O(1).
+static inline void offerTopK(TopKHeap *h, long long value) {
+    if (h->size == h->k) {
+        if (value > h->data[0]) {
+            siftDownTopK(h, value);
+        }
+        return;
+    }
+    int index = h->size++;
+    while (index > 0 && h->data[(index - 1) / 2] > value) {
+        h->data[index] = h->data[(index - 1) / 2];
+        index = (index - 1) / 2;
+    }
+    h->data[index] = value;
+}
+
+// Function to merge per-thread heaps: offer every survivor to one heap
+void mergeTopK(TopKHeap *result, Worker *workers, int numWorkers) {
+    for (int w = 0; w < numWorkers; w++) {
+        for (int i = 0; i < workers[w].heap.size; i++) {
+            offerTopK(result, workers[w].heap.data[i]);
+        }
+    }
+}
+
+static int compareDescending(const void *a, const void *b) {
+    long long x = *(const long long*)a;
+    long long y = *(const long long*)b;
+    return (x < y) - (x > y);
+}
+
+// Function to empty the heap into 'out', largest first
+int drainDescending(TopKHeap *h, long long *out) {
+    int n = h->size;
+    memcpy(out, h->data, sizeof(long long) * n);
+    qsort(out, n, sizeof(long long), compareDescending);
+    return n;
+}
+
+// ==================== CHUNK QUEUE ====================
+
+void initQueue(ChunkQueue *q) {
+    q->head = 0;
+    q->count = 0;
+    q->done = false;
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->notEmpty, NULL);
+    pthread_cond_init(&q->notFull, NULL);
+}
+
+void destroyQueue(ChunkQueue *q) {
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->notEmpty);
+    pthread_cond_destroy(&q->notFull);
+}
+
+void putChunk(ChunkQueue *q, Chunk chunk) {
+    pthread_mutex_lock(&q->lock);
+    while (q->count == QUEUE_SLOTS) {
+        pthread_cond_wait(&q->notFull, &q->lock);
+    }
+    q->slots[(q->head + q->count) % QUEUE_SLOTS] = chunk;
+    q->count++;
+    pthread_cond_signal(&q->notEmpty);
+    pthread_mutex_unlock(&q->lock);
+}
+
+// Function to take a chunk; returns false once input is finished
+bool takeChunk(ChunkQueue *q, Chunk *chunk) {
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0 && !q->done) {
+        pthread_cond_wait(&q->notEmpty, &q->lock);
+    }
+    if (q->count == 0) {
+        pthread_mutex_unlock(&q->lock);
+        return false;
+    }
+    *chunk = q->slots[q->head];
+    q->head = (q->head + 1) % QUEUE_SLOTS;
+    q->count--;
+    pthread_cond_signal(&q->notFull);
+    pthread_mutex_unlock(&q->lock);
+    return true;
+}
+
+void finishQueue(ChunkQueue *q) {
+    pthread_mutex_lock(&q->lock);
+    q->done = true;
+    pthread_cond_broadcast(&q->notEmpty);
+    pthread_mutex_unlock(&q->lock);
+}
+
+// ==================== STREAMING ====================
+
+// Function to parse whitespace-separated decimal integers (optional '-')
+// and offer each one; any other character also separates numbers. A token
+// whose magnitude exceeds LLONG_MAX is not offered but counted in *rejected.
+long long parseChunk(const char *p, const char *end, TopKHeap *h, long long *rejected) {
+    long long count = 0;
+    while (p < end) {
+        while (p < end && (*p < '0' || *p > '9') && *p != '-') {
+            p++;
+        }
+        if (p == end) {
+            break;
+        }
+        bool negative = *p == '-';
+        p += negative;
+        if (p == end || *p < '0' || *p > '9') {
+            continue;
+        }
+        long long value = 0;
+        bool overflow = false;
+        while (p < end && *p >= '0' && *p <= '9') {
+            int digit = *p - '0';
+            if (value > (LLONG_MAX - digit) / 10) {
+                overflow = true;
+            } else {
+                value = value * 10 + digit;
+            }
+            p++;
+        }
+        if (overflow) {
+            (*rejected)++;
+            continue;
+        }
+        offerTopK(h, negative ? -value : value);
+        count++;
+    }
+    return count;
+}
+
+void* streamWorker(void *arg) {
+    Worker *w = (Worker*)arg;
+    Chunk chunk;
+    while (takeChunk(w->queue, &chunk)) {
+        w->count += parseChunk(chunk.text, chunk.text + chunk.length, &w->heap, &w->rejected);
+        free(chunk.text);
+    }
+    return NULL;
+}
+
+// Function to read a stream in blocks, cut each block after its last
+// separator so no number is split, and hand the blocks to the workers.
+// Returns the number of bytes read.
+long long readChunks(FILE *input, ChunkQueue *q) {
+    char *carry = (char*)allocOrExit(CHUNK_BYTES);
+    size_t carried = 0;
+    long long totalBytes = 0;
+    while (true) {
+        char *text = (char*)allocOrExit(CHUNK_BYTES + CHUNK_BYTES);
+        memcpy(text, carry, carried);
+        size_t got = fread(text + carried, 1, CHUNK_BYTES, input);
+        totalBytes += got;
+        size_t length = carried + got;
+        if (got == 0) {
+            if (length > 0) {
+                putChunk(q, (Chunk){text, length});
+            } else {
+                free(text);
+            }
+            break;
+        }
+        size_t cut = length;
+        while (cut > 0 && ((text[cut - 1] >= '0' && text[cut - 1] <= '9') || text[cut - 1] == '-')) {
+            cut--;
+        }
+        if (length - cut >= CHUNK_BYTES) {
+            cut = length;      // Not text of numbers; pass it on rather than overflow
+        }
+        carried = length - cut;
+        memcpy(carry, text + cut, carried);
+        putChunk(q, (Chunk){text, cut});
+    }
+    free(carry);
+    finishQueue(q);
+    return totalBytes;
+}
+
+// Function to run the full pipeline on one stream: the calling thread reads,
+// numThreads workers parse and select, and the heaps are merged at the end
+long long streamTopK(FILE *input, int k, int numThreads, TopKHeap *result, long long *bytesRead,
+                     long long *rejected) {
+    ChunkQueue queue;
+    Worker workers[MAX_THREADS];
+    initQueue(&queue);
+    for (int t = 0; t < numThreads; t++) {
+        workers[t].queue = &queue;
+        workers[t].count = 0;
+        workers[t].rejected = 0;
+        initTopK(&workers[t].heap, k);
+        if (pthread_create(&workers[t].thread, NULL, streamWorker, &workers[t]) != 0) {
+            printf("Thread creation failed!\n");
+            exit(1);
+        }
+    }
+
+    *bytesRead = readChunks(input, &queue);
+
+    long long total = 0;
+    *rejected = 0;
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(workers[t].thread, NULL);
+        total += workers[t].count;
+        *rejected += workers[t].rejected;
+    }
+    mergeTopK(result, workers, numThreads);
+    for (int t = 0; t < numThreads; t++) {
+        freeTopK(&workers[t].heap);
+    }
+    destroyQueue(&queue);
+    return total;
+}
+
+// ==================== IN-MEMORY SELECTION ====================
+
+void* arrayWorker(void *arg) {
+    Worker *w = (Worker*)arg;
+    for (long long i = 0; i < w->numValues; i++) {
+        offerTopK(&w->heap, w->values[i]);
+    }
+    w->count = w->numValues;
+    return NULL;
+}
+
+// Function to select the top K of an array with numThreads slices
+void arrayTopK(const long long *values, long long n, int k, int numThreads, TopKHeap *result) {
+    Worker workers[MAX_THREADS];
+    long long slice = (n + numThreads - 1) / numThreads;
+    for (int t = 0; t < numThreads; t++) {
+        long long first = slice * t < n ? slice * t : n;
+        long long last = first + slice < n ? first + slice : n;
+        workers[t].values = values + first;
+        workers[t].numValues = last - first;
+        initTopK(&workers[t].heap, k);
+        if (pthread_create(&workers[t].thread, NULL, arrayWorker, &workers[t]) != 0) {
+            printf("Thread creation failed!\n");
+            exit(1);
+        }
+    }
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(workers[t].thread, NULL);
+    }
+    mergeTopK(result, workers, numThreads);
+    for (int t = 0; t < numThreads; t++) {
+        freeTopK(&workers[t].heap);
+    }
+}
+
+// The approach being replaced: sort everything, keep the first K
+void sortTopK(const long long *values, long long n, int k, long long *out) {
+    long long *copy = (long long*)allocOrExit(sizeof(long long) * n);
+    memcpy(copy, values, sizeof(long long) * n);
+    qsort(copy, n, sizeof(long long), compareDescending);
+    memcpy(out, copy, sizeof(long long) * (k < n ? k : n));
+    free(copy);
+}
+
+// ==================== DRIVER ====================
+
+void printTop(const long long *top, int n) {
+    printf("Top %d:", n < SHOW_TOP ? n : SHOW_TOP);
+    for (int i = 0; i < n && i < SHOW_TOP; i++) {
+        printf(" %lld", top[i]);
+    }
+    if (n > 0) {
+        printf("\nK-th largest (rank %d): %lld\n", n, top[n - 1]);
+    } else {
+        printf(" (no input)\n");
+    }
+}
+
+// Function to process a file (or "-" for stdin) and report throughput
+int runOnInput(const char *path, int k, int numThreads) {
+    FILE *input = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (input == NULL) {
+        printf("Cannot open %s!\n", path);
+        return 1;
+    }
+    TopKHeap result;
+    initTopK(&result, k);
+    long long bytes = 0;
+    long long rejected = 0;
+    double start = getTimeSeconds();
+    long long count = streamTopK(input, k, numThreads, &result, &bytes, &rejected);
+    double seconds = getTimeSeconds() - start;
+    if (input != stdin) {
+        fclose(input);
+    }
+
+    long long *top = (long long*)allocOrExit(sizeof(long long) * k);
+    int found = drainDescending(&result, top);
+    printf("Read %lld integers (%.1f MB) with %d worker thread%s in %.3f s\n", count, bytes / 1048576.0,
+           numThreads, numThreads == 1 ? "" : "s", seconds);
+    printf("Throughput: %.1f M elements/s, %.1f MB/s\n", count / seconds / 1e6, bytes / seconds / 1048576.0);
+    if (rejected > 0) {
+        printf("Rejected %lld token%s outside the long long range\n", rejected, rejected == 1 ? "" : "s");
+    }
+    printTop(top, found);
+    free(top);
+    freeTopK(&result);
+    return 0;
+}
+
+// Thread counts tried: 1, 2, 4, ... and finally numThreads itself
+static int nextThreadCount(int threads, int numThreads) {
+    if (threads == numThreads) {
+        return numThreads + 1;
+    }
+    return threads * 2 < numThreads ? threads * 2 : numThreads;
+}
+
+void runBenchmark(long long n, int k, int numThreads) {
+    long long *values = (long long*)allocOrExit(sizeof(long long) * n);
+    long long *expected = (long long*)allocOrExit(sizeof(long long) * k);
+    long long *top = (long long*)allocOrExit(sizeof(long long) * k);
+    uint64_t state = 99;
+    for (long long i = 0; i < n; i++) {
+        values[i] = (long long)(nextRandom(&state) >> 1);
+    }
+
+    printf("\nIn memory: %lld random 63-bit integers, K = %d\n", n, k);
+    printf("%-28s %10s %14s %8s\n", "Method", "Seconds", "M elements/s", "Same");
+    printf("-------------------------------------------------------------\n");
+    double start = getTimeSeconds();
+    sortTopK(values, n, k, expected);
+    double sortSeconds = getTimeSeconds() - start;
+    printf("%-28s %10.3f %14.1f %8s\n", "Full sort (qsort)", sortSeconds, n / sortSeconds / 1e6, "-");
+
+    for (int threads = 1; threads <= numThreads; threads = nextThreadCount(threads, numThreads)) {
+        TopKHeap result;
+        initTopK(&result, k);
+        start = getTimeSeconds();
+        arrayTopK(values, n, k, threads, &result);
+        double seconds = getTimeSeconds() - start;
+        int found = drainDescending(&result, top);
+        bool same = found == k && memcmp(top, expected, sizeof(long long) * k) == 0;
+        char label[64];
+        snprintf(label, sizeof(label), "Bounded heaps, %d thread%s", threads, threads == 1 ? "" : "s");
+        printf("%-28s %10.3f %14.1f %8s\n", label, seconds, n / seconds / 1e6, same ? "yes" : "NO");
+        freeTopK(&result);
+    }
+
+    // The same values as text, streamed through the reader/worker pipeline
+    FILE *file = tmpfile();
+    if (file == NULL) {
+        printf("Cannot create a temporary file!\n");
+        exit(1);
+    }
+    for (long long i = 0; i < n; i++) {
+        fprintf(file, "%lld\n", values[i]);
+    }
+    rewind(file);
+
+    printf("\nStreaming the same values from a text file:\n");
+    printf("%-28s %10s %14s %8s %8s\n", "Workers", "Seconds", "M elements/s", "MB/s", "Same");
+    printf("----------------------------------------------------------------------\n");
+    for (int threads = 1; threads <= numThreads; threads = nextThreadCount(threads, numThreads)) {
+        TopKHeap result;
+        initTopK(&result, k);
+        long long bytes = 0;
+        long long rejected = 0;
+        rewind(file);
+        start = getTimeSeconds();
+        long long count = streamTopK(file, k, threads, &result, &bytes, &rejected);
+        double seconds = getTimeSeconds() - start;
+        int found = drainDescending(&result, top);
+        bool same = count == n && rejected == 0 && found == k && memcmp(top, expected, sizeof(long long) * k) == 0;
+        printf("%-28d %10.3f %14.1f %8.1f %8s\n", threads, seconds, count / seconds / 1e6,
+               bytes / seconds / 1048576.0, same ? "yes" : "NO");
+        freeTopK(&result);
+    }
+    fclose(file);
+
+    free(values);
+    free(expected);
+    free(top);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  STREAMING TOP-K SELECTION\n");
+    printf("  Bounded Heaps with Parallel Merge\n");
+    printf("=========================================\n\n");
+
+    int k = 1000;
+    int numThreads = 4;
+    if (argc > 1) {
+        k = atoi(argv[1]);
+    }
+    if (argc > 3) {
+        numThreads = atoi(argv[3]);
+    }
+    if (k < 1 || k > 100000000 || numThreads < 1 || numThreads > MAX_THREADS) {
+        printf("Usage: %s [K] [file | - for stdin | count] [threads 1-%d]\n", argv[0], MAX_THREADS);
+        return 1;
+    }
+
+    // Anything but a plain number is a file (or "-" for stdin): stream it and stop
+    if (argc > 2 && argv[2][strspn(argv[2], "0123456789")] != '\0') {
+        return runOnInput(argv[2], k, numThreads);
+    }
+
+    // Small example on Program 6's array
+    long long arr[] = {15, 10, 20, 8, 12, 25, 6};
+    TopKHeap demo;
+    initTopK(&demo, 3);
+    printf("Stream: ");
+    for (int i = 0; i < 7; i++) {
+        offerTopK(&demo, arr[i]);
+        printf("%lld ", arr[i]);
+    }
+    long long top3[3];
+    int found = drainDescending(&demo, top3);
+    printf("\nTop 3 kept in a 3-slot min-heap: ");
+    for (int i = 0; i < found; i++) {
+        printf("%lld ", top3[i]);
+    }
+    printf("\n");
+    freeTopK(&demo);
+
+    long long n = argc > 2 ? atoll(argv[2]) : 20000000;
+    if (n < k) {
+        printf("Count must be at least K!\n");
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (top %d):\n", k);
+    printf("-------------------------------------------");
+    runBenchmark(n, k, numThreads);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
@@ -0,0 +1,409 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BUFFER_ELEMENTS 4096      // Keys buffered per run (16 KB)
+#define MAX_RUNS 4096
+
+// Exhausted runs present this key, so they lose every comparison and need
+// no special case in the tree; real keys must be smaller
+#define SENTINEL_KEY INT_MAX
+
+// Buffered sequential reader over one sorted run stored in a file. All runs
+// share one file; each reader has its own offset and buffer, and refills
+// with pread() so readers never disturb each other's position.
+typedef struct {
+    int fd;
+    off_t offset;             // Next byte to read
+    long long remaining;      // Keys still in the file
+    int *buffer;
+    int position;
+    int count;
+} RunReader;
+
+// Tree node: a key and its run packed into one 64-bit word. The key (with
+// its sign bit flipped, so signed order becomes unsigned order) is the high
+// half and the run the low half, so one unsigned comparison orders by key and
+// breaks ties by run, which keeps the merge stable. A replay compares stored
+// words without touching the readers, and 8 nodes share a cache line.
+typedef uint64_t Node;
+
+// Loser tree over k runs. Leaves are implicit (run r is leaf k + r); internal
+// node i (1 .. k-1) keeps the loser of the match played there, and node 0
+// keeps the overall winner. Node i's parent is i / 2.
+typedef struct {
+    Node *nodes;
+    int k;
+} LoserTree;
+
+// Output side of a merge: what a writer would see
+typedef struct {
+    long long count;
+    uint64_t checksum;
+    bool sorted;
+    int last;
+    long long comparisons;
+    double seconds;
+} MergeResult;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* allocOrExit(size_t bytes) {
+    void *memory = malloc(bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== RUN READERS ====================
+
+void openRun(RunReader *r, int fd, off_t offset, long long length) {
+    r->fd = fd;
+    r->offset = offset;
+    r->remaining = length;
+    r->buffer = (int*)allocOrExit(sizeof(int) * BUFFER_ELEMENTS);
+    r->position = 0;
+    r->count = 0;
+}
+
+void closeRun(RunReader *r) {
+    free(r->buffer);
+}
+
+static void refillRun(RunReader *r) {
+    long long want = r->remaining < BUFFER_ELEMENTS ? r->remaining : BUFFER_ELEMENTS;
+    ssize_t got = pread(r->fd, r->buffer, sizeof(int) * want, r->offset);
+    if (got != (ssize_t)(sizeof(int) * want)) {
+        printf("Read error on run file!\n");
+        exit(1);
+    }
+    r->offset += got;
+    r->remaining -= want;
+    r->position = 0;
+    r->count = (int)want;
+}
+
+// Function to get a run's next key, or SENTINEL_KEY once it is exhausted
+static inline int nextKey(RunReader *r) {
+    if (r->position == r->count) {
+        if (r->remaining == 0) {
+            return SENTINEL_KEY;
+        }
+        refillRun(r);
+    }
+    return r->buffer[r->position++];
+}
+
+static inline void emit(MergeResult *out, int key) {
+    out->sorted &= key >= out->last;
+    out->last = key;
+    out->checksum = (out->checksum ^ (uint32_t)key) * 1099511628211ULL;
+    out->count++;
+}
+
+static void startResult(MergeResult *out) {
+    memset(out, 0, sizeof(*out));
+    out->sorted = true;
+    out->last = INT_MIN;
+    out->checksum = 14695981039346656037ULL;
+}
+
+// ==================== PACKED NODES ====================
+
+static inline Node makeNode(int key, int run) {
+    return ((uint64_t)((uint32_t)key ^ 0x80000000u) << 32) | (uint32_t)run;
+}
+
+static inline int nodeKey(Node node) {
+    return (int)((uint32_t)(node >> 32) ^ 0x80000000u);
+}
+
+static inline int nodeRun(Node node) {
+    return (int)(uint32_t)node;
+}
+
+// ==================== LOSER TREE ====================
+
+// Function to build the tree: play every match bottom-up, keeping losers
+// in the internal nodes and passing winners up
+void buildLoserTree(LoserTree *t, RunReader *runs, int k, long long *comparisons) {
+    t->k = k;
+    t->nodes = (Node*)allocOrExit(sizeof(Node) * k);
+    Node *winners = (Node*)allocOrExit(sizeof(Node) * 2 * k);
+    for (int r = 0; r < k; r++) {
+        winners[k + r] = makeNode(nextKey(&runs[r]), r);
+    }
+    for (int i = k - 1; i >= 1; i--) {
+        Node left = winners[2 * i];
+        Node right = winners[2 * i + 1];
+        bool leftWins = left < right;
+        winners[i] = leftWins ? left : right;
+        t->nodes[i] = leftWins ? right : left;
+        (*comparisons)++;
+    }
+    t->nodes[0] = k > 1 ? winners[1] : winners[k];
+    free(winners);
+}
+
+void freeLoserTree(LoserTree *t) {
+    free(t->nodes);
+}
+
+// Function to merge: emit the winner, take the next key from its run, and
+// replay only the path from that run's leaf to the root. Each level is one
+// comparison against the stored loser: about log2(k) per element.
+void mergeLoserTree(RunReader *runs, int k, MergeResult *out) {
+    LoserTree t;
+    startResult(out);
+    double start = getTimeSeconds();
+    buildLoserTree(&t, runs, k, &out->comparisons);
+    Node *nodes = t.nodes;
+    long long comparisons = 0;
+
+    while (nodeKey(nodes[0]) != SENTINEL_KEY) {
+        int run = nodeRun(nodes[0]);
+        emit(out, nodeKey(nodes[0]));
+        Node current = makeNode(nextKey(&runs[run]), run);
+        for (int i = (k + run) / 2; i > 0; i /= 2) {
+            Node stored = nodes[i];
+            nodes[i] = stored < current ? current : stored;
+            current = stored < current ? stored : current;
+            comparisons++;
+        }
+        nodes[0] = current;
+    }
+
+    out->comparisons += comparisons;
+    out->seconds = getTimeSeconds() - start;
+    freeLoserTree(&t);
+}
+
+// ==================== HEAP BASELINE ====================
+
+// Function to merge with a binary min-heap of run heads, using replace-top
+// (one sift-down per element, two comparisons per level: about 2 log2(k))
+void mergeHeap(RunReader *runs, int k, MergeResult *out) {
+    Node *heap = (Node*)allocOrExit(sizeof(Node) * k);
+    int size = 0;
+    long long comparisons = 0;
+    startResult(out);
+    double start = getTimeSeconds();
+
+    for (int r = 0; r < k; r++) {
+        int key = nextKey(&runs[r]);
+        if (key == SENTINEL_KEY) {
+            continue;
+        }
+        Node item = makeNode(key, r);
+        int index = size++;
+        while (index > 0 && item < heap[(index - 1) / 2]) {
+            heap[index] = heap[(index - 1) / 2];
+            index = (index - 1) / 2;
+            comparisons++;
+        }
+        heap[index] = item;
+    }
+
+    while (size > 0) {
+        emit(out, nodeKey(heap[0]));
+        int run = nodeRun(heap[0]);
+        int key = nextKey(&runs[run]);
+        Node item = key == SENTINEL_KEY ? heap[--size] : makeNode(key, run);
+        int index = 0;
+        int child = 1;
+        while (child < size) {
+            if (child + 1 < size) {
+                child += heap[child + 1] < heap[child];
+                comparisons++;
+            }
+            comparisons++;
+            if (heap[child] >= item) {
+                break;
+            }
+            heap[index] = heap[child];
+            index = child;
+            child = 2 * index + 1;
+        }
+        heap[index] = item;
+    }
+
+    out->comparisons = comparisons;
+    out->seconds = getTimeSeconds() - start;
+    free(heap);
+}
+
+// ==================== BENCHMARK ====================
+
+// Function to write k sorted runs of 'runLength' keys into one temporary
+// file; returns its descriptor (the FILE is kept open through 'file')
+int writeRuns(FILE **file, int k, long long runLength, uint64_t seed) {
+    *file = tmpfile();
+    if (*file == NULL) {
+        printf("Cannot create a temporary file!\n");
+        exit(1);
+    }
+    int *block = (int*)allocOrExit(sizeof(int) * BUFFER_ELEMENTS);
+    uint64_t state = seed;
+    // Average step chosen so every run spans most of [0, INT_MAX / 2]
+    uint64_t maxStep = 2 * ((uint64_t)INT_MAX / 2) / (runLength + 1) + 1;
+    for (int r = 0; r < k; r++) {
+        long long value = nextRandom(&state) % maxStep;
+        for (long long i = 0; i < runLength; i += BUFFER_ELEMENTS) {
+            int n = runLength - i < BUFFER_ELEMENTS ? (int)(runLength - i) : BUFFER_ELEMENTS;
+            for (int j = 0; j < n; j++) {
+                block[j] = (int)value;
+                value += nextRandom(&state) % maxStep;
+            }
+            if (fwrite(block, sizeof(int), n, *file) != (size_t)n) {
+                printf("Write error on run file!\n");
+                exit(1);
+            }
+        }
+    }
+    free(block);
+    fflush(*file);
+    return fileno(*file);
+}
+
+void openRuns(RunReader *runs, int fd, int k, long long runLength) {
+    for (int r = 0; r < k; r++) {
+        openRun(&runs[r], fd, (off_t)(r * runLength * sizeof(int)), runLength);
+    }
+}
+
+void closeRuns(RunReader *runs, int k) {
+    for (int r = 0; r < k; r++) {
+        closeRun(&runs[r]);
+    }
+}
+
+void runBenchmark(long long total, int maxRuns) {
+    RunReader *runs = (RunReader*)allocOrExit(sizeof(RunReader) * maxRuns);
+    printf("%6s %11s %12s %12s %10s %10s %9s %6s\n", "k", "Run length", "Heap ns/el", "Loser ns/el",
+           "Heap cmp", "Loser cmp", "Speedup", "Same");
+    printf("------------------------------------------------------------------------------------\n");
+    for (int k = 2; k <= maxRuns; k *= 2) {
+        long long runLength = total / k;
+        FILE *file;
+        int fd = writeRuns(&file, k, runLength, 1000 + k);
+        long long n = runLength * k;
+
+        MergeResult heap;
+        MergeResult loser;
+        openRuns(runs, fd, k, runLength);
+        mergeHeap(runs, k, &heap);
+        closeRuns(runs, k);
+        openRuns(runs, fd, k, runLength);
+        mergeLoserTree(runs, k, &loser);
+        closeRuns(runs, k);
+        fclose(file);
+
+        bool same = heap.count == n && loser.count == n && heap.sorted && loser.sorted &&
+                    heap.checksum == loser.checksum;
+        printf("%6d %11lld %12.2f %12.2f %10.2f %10.2f %8.2fx %6s\n", k, runLength, heap.seconds / n * 1e9,
+               loser.seconds / n * 1e9, (double)heap.comparisons / n, (double)loser.comparisons / n,
+               heap.seconds / loser.seconds, same ? "yes" : "NO");
+    }
+    free(runs);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  LOSER-TREE K-WAY MERGE\n");
+    printf("  Tournament Tree vs Binary Heap\n");
+    printf("=========================================\n\n");
+
+    // Small example: 5 runs of different lengths, one of them empty
+    int small[][4] = {{3, 9, 14, 20}, {1, 8, 15, 0}, {5, 6, 0, 0}, {0, 0, 0, 0}, {2, 11, 12, 30}};
+    long long lengths[] = {4, 3, 2, 0, 4};
+    int k = 5;
+    FILE *file = tmpfile();
+    if (file == NULL) {
+        printf("Cannot create a temporary file!\n");
+        return 1;
+    }
+    RunReader runs[5];
+    off_t offset = 0;
+    for (int r = 0; r < k; r++) {
+        printf("Run %d:", r);
+        for (int i = 0; i < lengths[r]; i++) {
+            printf(" %d", small[r][i]);
+        }
+        printf("%s\n", lengths[r] == 0 ? " (empty)" : "");
+        fwrite(small[r], sizeof(int), lengths[r], file);
+    }
+    fflush(file);
+    for (int r = 0; r < k; r++) {
+        openRun(&runs[r], fileno(file), offset, lengths[r]);
+        offset += lengths[r] * sizeof(int);
+    }
+
+    LoserTree t;
+    long long comparisons = 0;
+    buildLoserTree(&t, runs, k, &comparisons);
+    printf("\nLoser tree after the initial tournament (%lld matches):\n", comparisons);
+    printf("  Winner: key %d from run %d\n", nodeKey(t.nodes[0]), nodeRun(t.nodes[0]));
+    for (int i = 1; i < k; i++) {
+        if (nodeKey(t.nodes[i]) == SENTINEL_KEY) {
+            printf("  Node %d loser: sentinel (run %d empty)\n", i, nodeRun(t.nodes[i]));
+        } else {
+            printf("  Node %d loser: key %d from run %d\n", i, nodeKey(t.nodes[i]), nodeRun(t.nodes[i]));
+        }
+    }
+    freeLoserTree(&t);
+    closeRuns(runs, k);
+
+    MergeResult result;
+    offset = 0;
+    for (int r = 0; r < k; r++) {
+        openRun(&runs[r], fileno(file), offset, lengths[r]);
+        offset += lengths[r] * sizeof(int);
+    }
+    printf("Merged: ");
+    mergeLoserTree(runs, k, &result);
+    closeRuns(runs, k);
+    fclose(file);
+    printf("%lld keys, sorted: %s, %lld comparisons\n", result.count, result.sorted ? "YES" : "NO",
+           result.comparisons);
+
+    long long total = 1 << 24;
+    int maxRuns = 1024;
+    if (argc > 1) {
+        total = atoll(argv[1]);
+    }
+    if (argc > 2) {
+        maxRuns = atoi(argv[2]);
+    }
+    if (maxRuns < 2 || maxRuns > MAX_RUNS || total < maxRuns) {
+        printf("Usage: %s [totalKeys] [maxRuns 2-%d]\n", argv[0], MAX_RUNS);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark (%lld keys from a run file, per output key):\n", total);
+    printf("-------------------------------------------\n");
+    runBenchmark(total, maxRuns);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
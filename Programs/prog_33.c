@@ -0,0 +1,454 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define INITIAL_CAPACITY 1024
+#define RADIX_BUCKETS 65          // Bucket 0 plus one per bit of a 64-bit key
+
+// Item of both priority queues: a key and a payload (vertex, event id, ...)
+typedef struct {
+    uint64_t key;
+    int value;
+} HeapItem;
+
+// Binary min-heap (as in Program 27), the comparison-based reference
+typedef struct {
+    HeapItem *data;
+    int size;
+    int capacity;
+} BinaryHeap;
+
+// Growable array of items
+typedef struct {
+    HeapItem *items;
+    int size;
+    int capacity;
+} Bucket;
+
+// Radix heap for monotone keys: every pushed key must be >= the last popped
+// minimum ('last'). An item lives in bucket b = bit length of (key ^ last),
+// i.e. bucket 0 holds keys equal to last and bucket b > 0 holds keys whose
+// highest bit differing from last is bit b - 1. Keys only ever move to
+// lower buckets, at most 64 times each (log2 of the key range, in practice).
+typedef struct {
+    Bucket buckets[RADIX_BUCKETS];
+    uint64_t last;
+    int size;
+} RadixHeap;
+
+// Weighted graph in compressed sparse row form (as in Program 29)
+typedef struct {
+    int numVertices;
+    long long *rowOffsets;
+    int *neighbors;
+    int *weights;
+} CSRGraph;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+void* reallocOrExit(void *memory, size_t bytes) {
+    memory = realloc(memory, bytes);
+    if (memory == NULL && bytes > 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// ==================== BINARY HEAP ====================
+
+void binaryHeapInit(BinaryHeap *h) {
+    h->capacity = INITIAL_CAPACITY;
+    h->data = (HeapItem*)reallocOrExit(NULL, sizeof(HeapItem) * h->capacity);
+    h->size = 0;
+}
+
+void binaryHeapFree(BinaryHeap *h) {
+    free(h->data);
+}
+
+int binaryHeapSize(BinaryHeap *h) {
+    return h->size;
+}
+
+bool binaryHeapPush(BinaryHeap *h, uint64_t key, int value) {
+    if (h->size == h->capacity) {
+        h->capacity *= 2;
+        h->data = (HeapItem*)reallocOrExit(h->data, sizeof(HeapItem) * h->capacity);
+    }
+    int index = h->size++;
+    while (index > 0 && h->data[(index - 1) / 2].key > key) {
+        h->data[index] = h->data[(index - 1) / 2];
+        index = (index - 1) / 2;
+    }
+    h->data[index].key = key;
+    h->data[index].value = value;
+    return true;
+}
+
+// Smallest item without removing it; the heap must not be empty
+HeapItem binaryHeapPeek(BinaryHeap *h) {
+    return h->data[0];
+}
+
+// Remove the smallest item; the heap must not be empty
+HeapItem binaryHeapPop(BinaryHeap *h) {
+    HeapItem top = h->data[0];
+    HeapItem last = h->data[--h->size];
+    int index = 0;
+    int child = 1;
+    while (child < h->size) {
+        if (child + 1 < h->size) {
+            child += h->data[child + 1].key < h->data[child].key;
+        }
+        if (h->data[child].key >= last.key) {
+            break;
+        }
+        h->data[index] = h->data[child];
+        index = child;
+        child = 2 * index + 1;
+    }
+    h->data[index] = last;
+    return top;
+}
+
+// ==================== RADIX HEAP ====================
+
+static inline int bucketIndex(uint64_t key, uint64_t last) {
+    return key == last ? 0 : 64 - __builtin_clzll(key ^ last);
+}
+
+static inline void bucketAppend(Bucket *b, HeapItem item) {
+    if (b->size == b->capacity) {
+        b->capacity = b->capacity > 0 ? b->capacity * 2 : 64;
+        b->items = (HeapItem*)reallocOrExit(b->items, sizeof(HeapItem) * b->capacity);
+    }
+    b->items[b->size++] = item;
+}
+
+void radixHeapInit(RadixHeap *h) {
+    memset(h, 0, sizeof(*h));
+}
+
+void radixHeapFree(RadixHeap *h) {
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        free(h->buckets[b].items);
+    }
+}
+
+int radixHeapSize(RadixHeap *h) {
+    return h->size;
+}
+
+// Function to push in O(1): one xor, one count-leading-zeros, one append.
+// Keys below the last popped minimum would break monotonicity and are rejected.
+bool radixHeapPush(RadixHeap *h, uint64_t key, int value) {
+    if (key < h->last) {
+        printf("Key %llu below the last popped minimum %llu!\n", (unsigned long long)key,
+               (unsigned long long)h->last);
+        return false;
+    }
+    HeapItem item = {key, value};
+    bucketAppend(&h->buckets[bucketIndex(key, h->last)], item);
+    h->size++;
+    return true;
+}
+
+// Function to make bucket 0 non-empty: find the lowest non-empty bucket, take
+// its minimum as the new 'last', and redistribute the bucket. Every item in
+// it shares the bits above its index with the new minimum, so each one lands
+// in a strictly lower bucket. The heap must not be empty.
+static void radixHeapNormalize(RadixHeap *h) {
+    if (h->buckets[0].size > 0) {
+        return;
+    }
+    int b = 1;
+    while (h->buckets[b].size == 0) {
+        b++;
+    }
+    Bucket *source = &h->buckets[b];
+    uint64_t minimum = source->items[0].key;
+    for (int i = 1; i < source->size; i++) {
+        minimum = source->items[i].key < minimum ? source->items[i].key : minimum;
+    }
+    h->last = minimum;
+    for (int i = 0; i < source->size; i++) {
+        bucketAppend(&h->buckets[bucketIndex(source->items[i].key, minimum)], source->items[i]);
+    }
+    source->size = 0;
+}
+
+HeapItem radixHeapPeek(RadixHeap *h) {
+    radixHeapNormalize(h);
+    Bucket *zero = &h->buckets[0];
+    return zero->items[zero->size - 1];
+}
+
+// Amortized O(log C) for keys spanning a range of C: the cost of a pop is
+// paid by the bucket moves of its items, at most log2(C) each
+HeapItem radixHeapPop(RadixHeap *h) {
+    radixHeapNormalize(h);
+    h->size--;
+    return h->buckets[0].items[--h->buckets[0].size];
+}
+
+// ==================== GRAPH (DIJKSTRA WORKLOAD) ====================
+
+// Road-like grid with random travel times 1 .. maxWeight (see Program 29)
+CSRGraph* generateRoadGrid(int side, int maxWeight, uint64_t seed) {
+    int n = side * side;
+    CSRGraph *g = (CSRGraph*)reallocOrExit(NULL, sizeof(CSRGraph));
+    g->numVertices = n;
+    g->rowOffsets = (long long*)reallocOrExit(NULL, sizeof(long long) * (n + 1));
+    g->neighbors = (int*)reallocOrExit(NULL, sizeof(int) * 4 * n);
+    g->weights = (int*)reallocOrExit(NULL, sizeof(int) * 4 * n);
+    // Weight of the edge to the right of / below each cell, shared by both ends
+    int *right = (int*)reallocOrExit(NULL, sizeof(int) * n);
+    int *down = (int*)reallocOrExit(NULL, sizeof(int) * n);
+    uint64_t state = seed;
+    for (int v = 0; v < n; v++) {
+        right[v] = 1 + nextRandom(&state) % maxWeight;
+        down[v] = 1 + nextRandom(&state) % maxWeight;
+    }
+    long long e = 0;
+    for (int v = 0; v < n; v++) {
+        int r = v / side;
+        int c = v % side;
+        g->rowOffsets[v] = e;
+        if (r > 0) {
+            g->neighbors[e] = v - side;
+            g->weights[e++] = down[v - side];
+        }
+        if (c > 0) {
+            g->neighbors[e] = v - 1;
+            g->weights[e++] = right[v - 1];
+        }
+        if (c + 1 < side) {
+            g->neighbors[e] = v + 1;
+            g->weights[e++] = right[v];
+        }
+        if (r + 1 < side) {
+            g->neighbors[e] = v + side;
+            g->weights[e++] = down[v];
+        }
+    }
+    g->rowOffsets[n] = e;
+    free(right);
+    free(down);
+    return g;
+}
+
+void freeCSR(CSRGraph *g) {
+    free(g->rowOffsets);
+    free(g->neighbors);
+    free(g->weights);
+    free(g);
+}
+
+// ==================== BENCHMARK ====================
+
+// The workloads are written once per queue type. A small macro stamps out a
+// copy for each, so both compile to direct, inlinable calls.
+#define DEFINE_WORKLOADS(Prefix, Heap)                                              \
+/* Hold model (event simulation): keep n events queued; each operation pops         \
+   the earliest and schedules it again 1 .. range time units later */               \
+static double Prefix##Hold(int n, long long ops, uint64_t range, uint64_t *sum) {   \
+    Heap h;                                                                         \
+    Prefix##Init(&h);                                                               \
+    uint64_t state = 7;                                                             \
+    for (int i = 0; i < n; i++) {                                                   \
+        Prefix##Push(&h, nextRandom(&state) % range, i);                            \
+    }                                                                               \
+    uint64_t checksum = 0;                                                          \
+    double start = getTimeSeconds();                                                \
+    for (long long i = 0; i < ops; i++) {                                           \
+        HeapItem item = Prefix##Pop(&h);                                            \
+        checksum = checksum * 31 + item.key;                                        \
+        uint64_t delta = 1 + nextRandom(&state) % range;                            \
+        Prefix##Push(&h, item.key + delta, item.value);                             \
+    }                                                                               \
+    double seconds = getTimeSeconds() - start;                                      \
+    *sum = checksum;                                                                \
+    Prefix##Free(&h);                                                               \
+    return seconds / ops * 1e9;                                                     \
+}                                                                                   \
+                                                                                    \
+/* Dijkstra with lazy deletion; returns ns per queue operation */                   \
+static double Prefix##Dijkstra(CSRGraph *g, uint32_t *distance, long long *ops) {   \
+    Heap h;                                                                         \
+    Prefix##Init(&h);                                                               \
+    long long count = 0;                                                            \
+    double start = getTimeSeconds();                                                \
+    for (int v = 0; v < g->numVertices; v++) {                                      \
+        distance[v] = UINT32_MAX;                                                   \
+    }                                                                               \
+    distance[0] = 0;                                                                \
+    Prefix##Push(&h, 0, 0);                                                         \
+    while (Prefix##Size(&h) > 0) {                                                  \
+        HeapItem item = Prefix##Pop(&h);                                            \
+        count++;                                                                    \
+        int u = item.value;                                                         \
+        if (item.key > distance[u]) {                                               \
+            continue;                                                               \
+        }                                                                           \
+        for (long long k = g->rowOffsets[u]; k < g->rowOffsets[u + 1]; k++) {       \
+            int v = g->neighbors[k];                                                \
+            uint32_t candidate = distance[u] + g->weights[k];                       \
+            if (candidate < distance[v]) {                                          \
+                distance[v] = candidate;                                            \
+                Prefix##Push(&h, candidate, v);                                     \
+                count++;                                                            \
+            }                                                                       \
+        }                                                                           \
+    }                                                                               \
+    double seconds = getTimeSeconds() - start;                                      \
+    *ops = count;                                                                   \
+    Prefix##Free(&h);                                                               \
+    return seconds / count * 1e9;                                                   \
+}
+
+DEFINE_WORKLOADS(binaryHeap, BinaryHeap)
+DEFINE_WORKLOADS(radixHeap, RadixHeap)
+
+void runHoldBenchmark(long long ops) {
+    int sizes[] = {1000, 100000, 1000000};
+    uint64_t ranges[] = {16, 4096, 1 << 24};
+    printf("\nHold model (%lld pop + push pairs, ns per pair):\n", ops);
+    printf("%10s %10s %12s %12s %9s %6s\n", "Queued", "Delta <=", "Binary", "Radix", "Speedup", "Same");
+    printf("-------------------------------------------------------------\n");
+    for (int s = 0; s < 3; s++) {
+        for (int r = 0; r < 3; r++) {
+            uint64_t binarySum;
+            uint64_t radixSum;
+            double binary = binaryHeapHold(sizes[s], ops, ranges[r], &binarySum);
+            double radix = radixHeapHold(sizes[s], ops, ranges[r], &radixSum);
+            printf("%10d %10llu %12.1f %12.1f %8.2fx %6s\n", sizes[s], (unsigned long long)ranges[r], binary,
+                   radix, binary / radix,
+                   binarySum == radixSum ? "yes" : "NO");
+        }
+    }
+}
+
+void runDijkstraBenchmark(int side) {
+    CSRGraph *g = generateRoadGrid(side, 1000, 11);
+    uint32_t *expected = (uint32_t*)reallocOrExit(NULL, sizeof(uint32_t) * g->numVertices);
+    uint32_t *distance = (uint32_t*)reallocOrExit(NULL, sizeof(uint32_t) * g->numVertices);
+    long long binaryOps;
+    long long radixOps;
+    double binary = binaryHeapDijkstra(g, expected, &binaryOps);
+    double radix = radixHeapDijkstra(g, distance, &radixOps);
+    bool same = memcmp(expected, distance, sizeof(uint32_t) * g->numVertices) == 0;
+
+    printf("\nDijkstra on a %dx%d road-like grid (weights 1-1000, lazy deletion):\n", side, side);
+    printf("%-10s %14s %12s %10s\n", "Queue", "Queue ops", "ns per op", "Total ms");
+    printf("-----------------------------------------------\n");
+    printf("%-10s %14lld %12.1f %10.1f\n", "Binary", binaryOps, binary, binary * binaryOps / 1e6);
+    printf("%-10s %14lld %12.1f %10.1f\n", "Radix", radixOps, radix, radix * radixOps / 1e6);
+    printf("Speedup: %.2fx, same distances: %s\n", (binary * binaryOps) / (radix * radixOps), same ? "yes" : "NO");
+
+    free(expected);
+    free(distance);
+    freeCSR(g);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  RADIX HEAP\n");
+    printf("  Monotone Integer Priority Queue\n");
+    printf("=========================================\n\n");
+
+    // The same calls on both queues
+    uint64_t keys[] = {15, 10, 20, 8, 12, 25, 6};
+    BinaryHeap binary;
+    RadixHeap radix;
+    binaryHeapInit(&binary);
+    radixHeapInit(&radix);
+    printf("Push: ");
+    for (int i = 0; i < 7; i++) {
+        binaryHeapPush(&binary, keys[i], i);
+        radixHeapPush(&radix, keys[i], i);
+        printf("%llu ", (unsigned long long)keys[i]);
+    }
+    printf("\nRadix buckets (last = %llu):\n", (unsigned long long)radix.last);
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        if (radix.buckets[b].size > 0) {
+            printf("  Bucket %d:", b);
+            for (int i = 0; i < radix.buckets[b].size; i++) {
+                printf(" %llu", (unsigned long long)radix.buckets[b].items[i].key);
+            }
+            printf("\n");
+        }
+    }
+
+    printf("Pop 3 (binary): ");
+    for (int i = 0; i < 3; i++) {
+        printf("%llu ", (unsigned long long)binaryHeapPop(&binary).key);
+    }
+    printf("\nPop 3 (radix):  ");
+    for (int i = 0; i < 3; i++) {
+        printf("%llu ", (unsigned long long)radixHeapPop(&radix).key);
+    }
+    printf("\nRadix buckets after popping (last = %llu):\n", (unsigned long long)radix.last);
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        if (radix.buckets[b].size > 0) {
+            printf("  Bucket %d:", b);
+            for (int i = 0; i < radix.buckets[b].size; i++) {
+                printf(" %llu", (unsigned long long)radix.buckets[b].items[i].key);
+            }
+            printf("\n");
+        }
+    }
+    printf("Push 5 into the radix heap: ");
+    radixHeapPush(&radix, 5, 0);
+    printf("Push 11 into both; drain (binary): ");
+    binaryHeapPush(&binary, 11, 0);
+    radixHeapPush(&radix, 11, 0);
+    while (binaryHeapSize(&binary) > 0) {
+        printf("%llu ", (unsigned long long)binaryHeapPop(&binary).key);
+    }
+    printf("\n%34s drain (radix):  ", "");
+    while (radixHeapSize(&radix) > 0) {
+        printf("%llu ", (unsigned long long)radixHeapPop(&radix).key);
+    }
+    printf("\n");
+    binaryHeapFree(&binary);
+    radixHeapFree(&radix);
+
+    long long ops = 5000000;
+    int side = 1000;
+    if (argc > 1) {
+        ops = atoll(argv[1]);
+    }
+    if (argc > 2) {
+        side = atoi(argv[2]);
+    }
+    if (ops < 1 || side < 2 || side > 30000) {
+        printf("Usage: %s [holdOps] [gridSide 2-30000]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Benchmark: binary heap vs radix heap\n");
+    printf("-------------------------------------------");
+    runHoldBenchmark(ops);
+    runDijkstraBenchmark(side);
+
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}
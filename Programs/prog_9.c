@@ -0,0 +1,401 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#define EMPTY_SLOT -1
+
+// Node structure for the recency list (doubly linked, as in Program 4)
+typedef struct LRUNode {
+    int key;
+    int value;
+    struct LRUNode *prev;
+    struct LRUNode *next;
+} LRUNode;
+
+// LRU cache structure
+typedef struct {
+    int capacity;       // Maximum number of entries
+    int size;           // Current number of entries
+    LRUNode *pool;      // Preallocated nodes (no malloc after creation)
+    LRUNode *freeList;  // Unused nodes from the pool, linked through next
+    LRUNode *head;      // Most recently used
+    LRUNode *tail;      // Least recently used
+    int *slots;         // Open-addressing hash table of pool indices
+    int slotMask;       // Table size - 1 (table size is a power of two)
+    int slotShift;      // 32 - log2(table size), selects the top hash bits
+    long long hits;
+    long long misses;
+    long long evictions;
+} LRUCache;
+
+// Get current time in seconds from a monotonic clock
+double getTimeSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Hash a key into a slot index (Fibonacci hashing)
+static inline int hashKey(LRUCache *cache, int key) {
+    return (int)(((uint32_t)key * 2654435769u) >> cache->slotShift);
+}
+
+// ==================== LRU CACHE FUNCTIONS ====================
+
+// Function to create a cache with a fixed capacity
+LRUCache* createLRUCache(int capacity) {
+    if (capacity < 1) {
+        printf("Invalid capacity!\n");
+        return NULL;
+    }
+
+    LRUCache *cache = (LRUCache*)malloc(sizeof(LRUCache));
+    if (cache == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    // Keep the table at most half full so probe sequences stay short
+    int tableSize = 2;
+    int tableBits = 1;
+    while (tableSize < 2 * capacity) {
+        tableSize *= 2;
+        tableBits++;
+    }
+
+    cache->pool = (LRUNode*)malloc(sizeof(LRUNode) * capacity);
+    cache->slots = (int*)malloc(sizeof(int) * tableSize);
+    if (cache->pool == NULL || cache->slots == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    cache->capacity = capacity;
+    cache->size = 0;
+    cache->slotMask = tableSize - 1;
+    cache->slotShift = 32 - tableBits;
+    cache->head = NULL;
+    cache->tail = NULL;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+
+    for (int i = 0; i < tableSize; i++) {
+        cache->slots[i] = EMPTY_SLOT;
+    }
+
+    // Chain every pool node into the free list
+    for (int i = 0; i < capacity - 1; i++) {
+        cache->pool[i].next = &cache->pool[i + 1];
+    }
+    cache->pool[capacity - 1].next = NULL;
+    cache->freeList = &cache->pool[0];
+
+    return cache;
+}
+
+// Function to unlink a node from the recency list
+void unlinkNode(LRUCache *cache, LRUNode *node) {
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        cache->head = node->next;
+    }
+
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        cache->tail = node->prev;
+    }
+}
+
+// Function to insert a node at the beginning (most recently used end)
+void insertAtBeginning(LRUCache *cache, LRUNode *node) {
+    node->prev = NULL;
+    node->next = cache->head;
+
+    if (cache->head != NULL) {
+        cache->head->prev = node;
+    } else {
+        cache->tail = node;
+    }
+    cache->head = node;
+}
+
+// Function to find the slot holding a key, or the empty slot ending its probe
+int findSlot(LRUCache *cache, int key) {
+    int slot = hashKey(cache, key);
+    while (cache->slots[slot] != EMPTY_SLOT &&
+           cache->pool[cache->slots[slot]].key != key) {
+        slot = (slot + 1) & cache->slotMask;
+    }
+    return slot;
+}
+
+// Function to remove a slot using backward-shift deletion (no tombstones)
+void removeSlot(LRUCache *cache, int slot) {
+    int hole = slot;
+    int next = (hole + 1) & cache->slotMask;
+
+    while (cache->slots[next] != EMPTY_SLOT) {
+        int home = hashKey(cache, cache->pool[cache->slots[next]].key);
+
+        // Move the entry back if its home is not between the hole and next
+        if (((next - home) & cache->slotMask) >= ((next - hole) & cache->slotMask)) {
+            cache->slots[hole] = cache->slots[next];
+            hole = next;
+        }
+        next = (next + 1) & cache->slotMask;
+    }
+    cache->slots[hole] = EMPTY_SLOT;
+}
+
+// Function to evict the least recently used entry
+void evictLRU(LRUCache *cache) {
+    LRUNode *victim = cache->tail;
+    if (victim == NULL) {
+        return;
+    }
+
+    removeSlot(cache, findSlot(cache, victim->key));
+    unlinkNode(cache, victim);
+
+    victim->next = cache->freeList;
+    cache->freeList = victim;
+    cache->size--;
+    cache->evictions++;
+}
+
+// Function to look up a key; moves it to the front on a hit
+bool lruGet(LRUCache *cache, int key, int *value) {
+    int index = cache->slots[findSlot(cache, key)];
+
+    if (index == EMPTY_SLOT) {
+        cache->misses++;
+        return false;
+    }
+
+    LRUNode *node = &cache->pool[index];
+    if (node != cache->head) {
+        unlinkNode(cache, node);
+        insertAtBeginning(cache, node);
+    }
+
+    *value = node->value;
+    cache->hits++;
+    return true;
+}
+
+// Function to insert or update a key, evicting the LRU entry when full
+void lruPut(LRUCache *cache, int key, int value) {
+    int slot = findSlot(cache, key);
+
+    if (cache->slots[slot] != EMPTY_SLOT) {
+        LRUNode *node = &cache->pool[cache->slots[slot]];
+        node->value = value;
+        if (node != cache->head) {
+            unlinkNode(cache, node);
+            insertAtBeginning(cache, node);
+        }
+        return;
+    }
+
+    if (cache->size == cache->capacity) {
+        evictLRU(cache);
+        // Eviction may have shifted entries, so probe again
+        slot = findSlot(cache, key);
+    }
+
+    LRUNode *node = cache->freeList;
+    cache->freeList = node->next;
+    node->key = key;
+    node->value = value;
+
+    cache->slots[slot] = (int)(node - cache->pool);
+    insertAtBeginning(cache, node);
+    cache->size++;
+}
+
+// Function to display cache contents from most to least recently used
+void displayCache(LRUCache *cache) {
+    if (cache->head == NULL) {
+        printf("Cache is empty.\n");
+        return;
+    }
+
+    printf("MRU -> ");
+    LRUNode *temp = cache->head;
+    while (temp != NULL) {
+        printf("(%d:%d)", temp->key, temp->value);
+        if (temp->next != NULL) {
+            printf(" <-> ");
+        }
+        temp = temp->next;
+    }
+    printf(" <- LRU  [%d/%d]\n", cache->size, cache->capacity);
+}
+
+// Function to reset hit/miss counters
+void resetStats(LRUCache *cache) {
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+}
+
+// Function to free the cache
+void freeLRUCache(LRUCache *cache) {
+    free(cache->pool);
+    free(cache->slots);
+    free(cache);
+}
+
+// ==================== ZIPFIAN TRACE GENERATION ====================
+
+// xorshift64* random number generator (deterministic for a given seed)
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+// Function to generate a Zipfian key trace over numKeys distinct keys
+void generateZipfTrace(int trace[], int numOps, int numKeys, double skew, uint64_t seed) {
+    double *cdf = (double*)malloc(sizeof(double) * numKeys);
+    if (cdf == NULL) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    // Cumulative distribution of P(rank) proportional to 1 / rank^skew
+    double sum = 0.0;
+    for (int i = 0; i < numKeys; i++) {
+        sum += 1.0 / pow(i + 1, skew);
+        cdf[i] = sum;
+    }
+
+    uint64_t state = seed;
+    for (int i = 0; i < numOps; i++) {
+        double u = (nextRandom(&state) >> 11) * (1.0 / 9007199254740992.0) * sum;
+
+        // Binary search for the first rank whose cumulative weight exceeds u
+        int low = 0;
+        int high = numKeys - 1;
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (cdf[mid] <= u) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        // Scatter ranks over the key space so popular keys are not adjacent
+        trace[i] = (int)(((uint32_t)low * 2654435761u) & 0x7fffffff);
+    }
+
+    free(cdf);
+}
+
+// Function to replay a trace (get, then put on miss) and report results
+void replayTrace(LRUCache *cache, int trace[], int numOps, double skew) {
+    resetStats(cache);
+
+    double start = getTimeSeconds();
+    for (int i = 0; i < numOps; i++) {
+        int value;
+        if (!lruGet(cache, trace[i], &value)) {
+            lruPut(cache, trace[i], trace[i]);
+        }
+    }
+    double end = getTimeSeconds();
+
+    double hitRate = 100.0 * cache->hits / numOps;
+    double nsPerOp = (end - start) * 1e9 / numOps;
+
+    printf("%10d  %6.2f  %9.2f%%  %10lld  %8.1f\n",
+           cache->capacity, skew, hitRate, cache->evictions, nsPerOp);
+}
+
+int main(int argc, char *argv[]) {
+    printf("=========================================\n");
+    printf("  LRU CACHE ON A DOUBLY LINKED LIST\n");
+    printf("=========================================\n\n");
+
+    // Small demonstration
+    printf("Creating LRU cache with capacity 3\n\n");
+    LRUCache *demo = createLRUCache(3);
+
+    lruPut(demo, 1, 100);
+    lruPut(demo, 2, 200);
+    lruPut(demo, 3, 300);
+    printf("After put(1), put(2), put(3):\n");
+    displayCache(demo);
+
+    int value;
+    if (lruGet(demo, 1, &value)) {
+        printf("\nget(1) = %d (hit, moved to front)\n", value);
+    }
+    displayCache(demo);
+
+    lruPut(demo, 4, 400);
+    printf("\nput(4) evicts least recently used key 2:\n");
+    displayCache(demo);
+
+    printf("\nget(2) is a %s\n", lruGet(demo, 2, &value) ? "hit" : "miss");
+
+    lruPut(demo, 3, 333);
+    printf("put(3, 333) updates in place and moves to front:\n");
+    displayCache(demo);
+    freeLRUCache(demo);
+
+    // Benchmark with Zipfian traces
+    int numKeys = 1000000;
+    int numOps = 10000000;
+    if (argc > 1) {
+        numKeys = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        numOps = atoi(argv[2]);
+    }
+    if (numKeys < 1 || numOps < 1) {
+        printf("Usage: %s [numKeys] [numOps]\n", argv[0]);
+        return 1;
+    }
+
+    printf("\n-------------------------------------------\n");
+    printf("Zipfian Trace Benchmark:\n");
+    printf("-------------------------------------------\n");
+    printf("Distinct keys: %d, operations per trace: %d\n\n", numKeys, numOps);
+
+    int *trace = (int*)malloc(sizeof(int) * numOps);
+    if (trace == NULL) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    double skews[] = {0.8, 0.99, 1.2};
+    int numSkews = sizeof(skews) / sizeof(skews[0]);
+    int capacities[] = {numKeys / 1000, numKeys / 100, numKeys / 10};
+    int numCapacities = sizeof(capacities) / sizeof(capacities[0]);
+
+    printf("  Capacity    Skew   Hit Rate   Evictions     ns/op\n");
+    printf("----------------------------------------------------\n");
+    for (int s = 0; s < numSkews; s++) {
+        generateZipfTrace(trace, numOps, numKeys, skews[s], 42 + s);
+
+        for (int c = 0; c < numCapacities; c++) {
+            int capacity = capacities[c] > 0 ? capacities[c] : 1;
+            LRUCache *cache = createLRUCache(capacity);
+            replayTrace(cache, trace, numOps, skews[s]);
+            freeLRUCache(cache);
+        }
+    }
+
+    free(trace);
+    printf("\nProgram completed successfully!\n");
+    return 0;
+}